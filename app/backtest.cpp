@@ -1,10 +1,10 @@
-#include <ctime>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 
 #include "backtest/backtest_engine.hpp"
+#include "civil_date.hpp"
 #include "rsi_strategy.hpp"
 #include "sma_crossover.hpp"
 #include "yfinance.hpp"
@@ -21,10 +21,7 @@ struct Defer {
 };
 
 inline std::string formatTime(const int64_t timestamp) {
-    const std::time_t t = static_cast<std::time_t>(timestamp);
-    char              mbstr[100];
-    std::strftime(mbstr, sizeof(mbstr), "%Y-%m-%d", std::localtime(&t));
-    return mbstr;
+    return civil::formatDate(timestamp);
 }
 
 void printSummary(const BacktestResult& result, const StockInfo& data) {
@@ -1,12 +1,12 @@
 #include <algorithm>
 #include <cmath>
-#include <ctime>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 #include <map>
 #include <vector>
 
+#include "civil_date.hpp"
 #include "yfinance.hpp"
 
 struct Defer {
@@ -21,16 +21,11 @@ struct Defer {
 };
 
 inline std::string formatTime(const int64_t timestamp) {
-    const std::time_t t = static_cast<std::time_t>(timestamp);
-    char              mbstr[100];
-    std::strftime(mbstr, sizeof(mbstr), "%Y-%m-%d", std::localtime(&t));
-    return mbstr;
+    return civil::formatDate(timestamp);
 }
 
 inline int getYear(const int64_t timestamp) {
-    const std::time_t t  = static_cast<std::time_t>(timestamp);
-    struct tm*        tm = std::localtime(&t);
-    return tm->tm_year + 1900;
+    return static_cast<int>(civil::civilFromDays(civil::toDays(timestamp)).year);
 }
 
 int main(int argc, char* argv[]) {
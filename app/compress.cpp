@@ -0,0 +1,141 @@
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "compressed_series.hpp"
+#include "yfinance.hpp"
+
+struct Defer {
+    std::function<void()> f;
+    explicit Defer(std::function<void()> f)
+        : f(std::move(f)) {}
+    ~Defer() {
+        if (f) {
+            f();
+        }
+    }
+};
+
+/* Raw in-memory footprint of the historical columns */
+static std::size_t rawBytes(const StockInfo& data) {
+    return data.timestamps.size() * sizeof(int64_t)
+         + (data.open.size() + data.high.size() + data.low.size() + data.close.size()) * sizeof(double)
+         + data.volume.size() * sizeof(int64_t);
+}
+
+/* Best-of-N wall time of fn, in seconds */
+static double timeIt(const std::function<void()>& fn, int repeat = 20) {
+    double best = 1e18;
+    for (int i = 0; i < repeat; ++i) {
+        const auto t0 = std::chrono::steady_clock::now();
+        fn();
+        const auto t1 = std::chrono::steady_clock::now();
+        best          = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return best;
+}
+
+void printHeader() {
+    // clang-format off
+    std::clog << std::left
+        << std::setw(10) << "(Ticker)"
+        << std::right
+        << std::setw(10) << "(Bars)"
+        << std::setw(12) << "(Raw KB)"
+        << std::setw(12) << "(Comp KB)"
+        << std::setw(10) << "(Ratio)"
+        << std::setw(10) << "(B/bar)"
+        << std::setw(14) << "(Raw Mbar/s)"
+        << std::setw(15) << "(Dec Mbar/s)"
+        << "\n-"
+        << std::endl;
+    // clang-format on
+}
+
+int main(int argc, char* argv[]) {
+    yFinance::init();
+    Defer _cleanup([] { yFinance::close(); });
+
+    const std::string INTERVAL = ((argc > 1) ? argv[1] : "1m");
+    const std::string RANGE    = ((argc > 2) ? argv[2] : "7d");
+
+    std::vector<std::string> tickers;
+    for (int i = 3; i < argc; ++i) {
+        tickers.emplace_back(argv[i]);
+    }
+    if (tickers.empty()) {
+        tickers = {"AAPL", "MSFT", "SPY", "QQQ", "^IXIC"};
+    }
+
+    printHeader();
+
+    std::size_t totalRaw  = 0;
+    std::size_t totalComp = 0;
+
+    for (const auto& ticker : tickers) {
+        const auto data = yFinance::getStockInfo(ticker, INTERVAL, RANGE);
+        if (!data || data->timestamps.empty()) {
+            std::cerr << "  [WARN] " << ticker << " - no data" << std::endl;
+            continue;
+        }
+
+        const auto        series = CompressedSeries::encode(*data);
+        const std::size_t n      = series.size();
+        const std::size_t raw    = rawBytes(*data);
+
+        // Baseline: stream the raw close column
+        volatile double sink    = 0.0;
+        const double    rawSecs = timeIt([&] {
+            double sum = 0.0;
+            for (const auto& c : data->close) {
+                sum += c;
+            }
+            sink = sum;
+        });
+
+        // Block-wise decode of every column into one reused scratch buffer
+        StockInfo    scratch;
+        const double decSecs = timeIt([&] {
+            double sum = 0.0;
+            for (std::size_t b = 0; b < series.blockCount(); ++b) {
+                series.decodeBlock(b, scratch);
+                for (const auto& c : scratch.close) {
+                    sum += c;
+                }
+            }
+            sink = sum;
+        });
+        (void)sink;
+
+        totalRaw += raw;
+        totalComp += series.bytes();
+
+        // clang-format off
+        std::clog << std::left
+            << std::setw(10) << ticker
+            << std::right << std::fixed
+            << std::setw(10) << n
+            << std::setprecision(1)
+            << std::setw(12) << static_cast<double>(raw) / 1024.0
+            << std::setw(12) << static_cast<double>(series.bytes()) / 1024.0
+            << std::setprecision(2)
+            << std::setw(9) << static_cast<double>(raw) / static_cast<double>(series.bytes()) << "x"
+            << std::setw(10) << static_cast<double>(series.bytes()) / static_cast<double>(n)
+            << std::setprecision(1)
+            << std::setw(14) << static_cast<double>(n) / rawSecs / 1e6
+            << std::setw(15) << static_cast<double>(n) / decSecs / 1e6
+            << std::endl;
+        // clang-format on
+    }
+
+    if (totalComp > 0) {
+        std::clog << "-" << std::endl;
+        std::clog << "Overall ratio:  " << std::fixed << std::setprecision(2)
+                  << static_cast<double>(totalRaw) / static_cast<double>(totalComp) << "x" << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+
+#include "civil_date.hpp"
+#include "csv_reader.hpp"
+
+/* Write a synthetic 1-minute OHLCV file (Yahoo CSV layout) */
+static void writeSample(const std::string& path, std::size_t rows) {
+    std::FILE* f = std::fopen(path.c_str(), "w");
+    if (!f) {
+        std::cerr << "Cannot create " << path << std::endl;
+        return;
+    }
+
+    std::mt19937_64                  rng(42);
+    std::normal_distribution<double> step(0.0, 0.0005);
+
+    std::fprintf(f, "Date,Open,High,Low,Close,Adj Close,Volume\n");
+
+    int64_t ts    = civil::toTimestamp(civil::daysFromCivil(2015, 1, 2)) + 14 * 3600 + 30 * 60;
+    double  price = 100.0;
+    char    date[16];
+    for (std::size_t i = 0; i < rows; ++i) {
+        const double open  = price;
+        const double close = open * (1.0 + step(rng));
+        const double high  = std::max(open, close) * (1.0 + std::abs(step(rng)));
+        const double low   = std::min(open, close) * (1.0 - std::abs(step(rng)));
+        price              = close;
+
+        civil::formatDateTime(ts, date);
+        std::fprintf(f, "%.16s:00,%.6f,%.6f,%.6f,%.6f,%.6f,%lld\n", date, open, high, low, close, close,
+                     static_cast<long long>(1000 + rng() % 100000));
+        ts += 60;
+    }
+
+    std::fclose(f);
+}
+
+/* Typical getline + stringstream + stod reader */
+static bool iostreamLoad(const std::string& path, StockInfo& out) {
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        return false;
+    }
+
+    out.timestamps.clear();
+    out.open.clear();
+    out.high.clear();
+    out.low.clear();
+    out.close.clear();
+    out.volume.clear();
+
+    std::string line;
+    std::getline(in, line);  // header
+
+    std::string field;
+    while (std::getline(in, line)) {
+        std::istringstream ss(line);
+        std::string        cols[7];
+        int                n = 0;
+        while (n < 7 && std::getline(ss, field, ',')) {
+            cols[n++] = field;
+        }
+        if (n < 7) {
+            continue;
+        }
+
+        int64_t days = 0;
+        if (!civil::parseDatePrefix(cols[0], days)) {
+            continue;
+        }
+        const int64_t seconds = std::stoi(cols[0].substr(11, 2)) * 3600 + std::stoi(cols[0].substr(14, 2)) * 60
+                              + std::stoi(cols[0].substr(17, 2));
+
+        out.timestamps.push_back(civil::toTimestamp(days) + seconds);
+        out.open.push_back(std::stod(cols[1]));
+        out.high.push_back(std::stod(cols[2]));
+        out.low.push_back(std::stod(cols[3]));
+        out.close.push_back(std::stod(cols[4]));
+        out.volume.push_back(std::stoll(cols[6]));
+    }
+    return true;
+}
+
+/* Best-of-N wall time of fn, in seconds */
+static double timeIt(const std::function<void()>& fn, int repeat = 3) {
+    double best = 1e18;
+    for (int i = 0; i < repeat; ++i) {
+        const auto t0 = std::chrono::steady_clock::now();
+        fn();
+        const auto t1 = std::chrono::steady_clock::now();
+        best          = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    std::string       path = ((argc > 1) ? argv[1] : "");
+    const std::size_t rows = ((argc > 2) ? std::stoul(argv[2]) : 2000000);
+
+    if (path.empty()) {
+        path = "csv_bench_sample.csv";
+        std::clog << "Generating " << rows << " rows into " << path << "..." << std::endl;
+        writeSample(path, rows);
+    }
+
+    std::ifstream probe(path, std::ios::binary | std::ios::ate);
+    if (!probe.is_open()) {
+        std::cerr << "Cannot open " << path << std::endl;
+        return 1;
+    }
+    const double mb = static_cast<double>(probe.tellg()) / (1024.0 * 1024.0);
+
+    StockInfo fast;
+    StockInfo slow;
+
+    const double fastSecs = timeIt([&] { CsvReader::load(path, fast); });
+    const double slowSecs = timeIt([&] { iostreamLoad(path, slow); });
+
+    const bool match = fast.timestamps == slow.timestamps && fast.close == slow.close && fast.volume == slow.volume;
+
+    // clang-format off
+    std::clog << std::fixed << std::setprecision(1)
+        << "File:      " << path << " (" << mb << " MB, " << fast.timestamps.size() << " rows)\n"
+        << "-\n"
+        << std::left << std::setw(12) << "(Reader)" << std::right << std::setw(12) << "(Seconds)"
+        << std::setw(12) << "(MB/s)" << std::setw(14) << "(Mrows/s)" << "\n"
+        << std::left << std::setw(12) << "CsvReader" << std::right << std::setprecision(3)
+        << std::setw(12) << fastSecs << std::setprecision(1) << std::setw(12) << mb / fastSecs
+        << std::setw(14) << static_cast<double>(fast.timestamps.size()) / fastSecs / 1e6 << "\n"
+        << std::left << std::setw(12) << "iostream" << std::right << std::setprecision(3)
+        << std::setw(12) << slowSecs << std::setprecision(1) << std::setw(12) << mb / slowSecs
+        << std::setw(14) << static_cast<double>(slow.timestamps.size()) / slowSecs / 1e6 << "\n"
+        << "-\n"
+        << "Speedup:   " << std::setprecision(2) << slowSecs / fastSecs << "x"
+        << (match ? "" : "  [WARN] results differ") << std::endl;
+    // clang-format on
+
+    return 0;
+}
@@ -2,6 +2,7 @@
 #include <iomanip>
 #include <iostream>
 
+#include "civil_date.hpp"
 #include "yfinance.hpp"
 
 struct Defer {
@@ -16,10 +17,7 @@ struct Defer {
 };
 
 inline std::string formatTime(const int64_t timestamp) {
-    const std::time_t t = static_cast<std::time_t>(timestamp);
-    char              mbstr[100];
-    std::strftime(mbstr, sizeof(mbstr), "%Y-%m-%d %H:%M", std::localtime(&t));
-    return mbstr;
+    return civil::formatDate(timestamp);
 }
 
 void printHeader() {
@@ -44,13 +42,13 @@ int main() {
 
     printHeader();
 
-    for (std::size_t i = 0; i < data->timestamps.size(); i++) {
+    for (std::size_t i = 0; i < data->days.size(); i++) {
         // clang-format off
         std::clog << std::left
-            << std::setw(20) << formatTime(data->timestamps[i])
+            << std::setw(20) << formatTime(static_cast<int64_t>(data->days[i]) * 86400)
             << std::fixed << std::setprecision(2)
             << std::setw(9) << data->scores[i]
-            << std::setw(15) << data->ratings[i]
+            << std::setw(15) << fngRatingToString(data->ratings[i])
             << std::endl;
         // clang-format on
     }
@@ -11,6 +11,8 @@
 
 #include <nlohmann/json.hpp>
 
+#include "archive/series_archive.hpp"
+#include "civil_date.hpp"
 #include "macro/macro_backtester.hpp"
 #include "macro_scorer.hpp"
 #include "yfinance.hpp"
@@ -82,11 +84,9 @@ static std::vector<std::string> buildDates(const std::shared_ptr<StockInfo>& sto
     }
     dates.reserve(stock->timestamps.size() - 1);
     for (size_t i = 1; i < stock->timestamps.size(); ++i) {
-        time_t     t  = static_cast<time_t>(stock->timestamps[i]);
-        struct tm* tm = gmtime(&t);
-        char       buf[11];
-        strftime(buf, sizeof(buf), "%Y-%m-%d", tm);
-        dates.emplace_back(buf);
+        char buf[10];
+        civil::formatDate(stock->timestamps[i], buf);
+        dates.emplace_back(buf, sizeof(buf));
     }
     return dates;
 }
@@ -160,8 +160,12 @@ int main(int argc, char* argv[]) {
     std::cerr << "Fetching FRED data (" << warmupDate << " ~ " << endDate << ")..." << std::endl;
 
     std::map<std::string, std::shared_ptr<FredSeriesInfo>> fredData;
+    // Histories are archived locally and re-fetched at most once a day
+    const SeriesArchive archive("archive");
     for (const auto& id : fredIds) {
-        auto result = yFinance::getFredSeries(id, apiKey, warmupDate, endDate, "m");
+        auto result = archive.fredSeries(id, "m", warmupDate, endDate, civil::kSecondsPerDay, [&] {
+            return yFinance::getFredSeries(id, apiKey, warmupDate, endDate, "m");
+        });
         if (result && !result->values.empty()) {
             fredData[id] = result;
             std::cerr << "  [OK] " << id << " (" << result->values.size() << " obs)" << std::endl;
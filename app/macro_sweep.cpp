@@ -14,7 +14,10 @@
 
 #include <nlohmann/json.hpp>
 
+#include "archive/series_archive.hpp"
+#include "civil_date.hpp"
 #include "macro/macro_backtester.hpp"
+#include "macro/sweep_results.hpp"
 #include "macro_scorer.hpp"
 #include "yfinance.hpp"
 
@@ -78,11 +81,9 @@ static std::vector<std::string> buildDates(const std::shared_ptr<StockInfo>& sto
         return dates;
     dates.reserve(stock->timestamps.size() - 1);
     for (size_t i = 1; i < stock->timestamps.size(); ++i) {
-        time_t     t  = static_cast<time_t>(stock->timestamps[i]);
-        struct tm* tm = gmtime(&t);
-        char       buf[11];
-        strftime(buf, sizeof(buf), "%Y-%m-%d", tm);
-        dates.emplace_back(buf);
+        char buf[10];
+        civil::formatDate(stock->timestamps[i], buf);
+        dates.emplace_back(buf, sizeof(buf));
     }
     return dates;
 }
@@ -93,28 +94,20 @@ static std::shared_ptr<StockInfo> trimStock(const std::shared_ptr<StockInfo>& fu
         return nullptr;
     auto result    = std::make_shared<StockInfo>();
     result->ticker = full->ticker;
-    for (size_t i = 0; i < full->timestamps.size(); ++i) {
-        time_t     t  = static_cast<time_t>(full->timestamps[i]);
-        struct tm* tm = gmtime(&t);
-        char       buf[11];
-        strftime(buf, sizeof(buf), "%Y-%m-%d", tm);
-        std::string d(buf);
-        if (d >= start && d <= end) {
-            result->timestamps.push_back(full->timestamps[i]);
-            result->close.push_back(full->close[i]);
-        }
+
+    const auto [first, last] = full->range(start, end);
+    const auto closeEnd      = std::min(last, full->close.size());
+    result->timestamps.assign(full->timestamps.begin() + static_cast<long>(first),
+                              full->timestamps.begin() + static_cast<long>(last));
+    if (first < closeEnd) {
+        result->close.assign(full->close.begin() + static_cast<long>(first),
+                             full->close.begin() + static_cast<long>(closeEnd));
     }
     return result;
 }
 
 /* ---- Data types ---- */
 
-struct SweepCell {
-    double cagr   = 0.0;
-    double sharpe = 0.0;
-    double mdd    = 0.0;
-};
-
 struct PortfolioRank {
     std::string name;
     std::string bestStrategy;
@@ -195,6 +188,9 @@ int main(int argc, char* argv[]) {
     double      cagrW     = sweepCfg.value("/ranking/cagr_weight"_json_pointer, 0.35);
     double      sharpeW   = sweepCfg.value("/ranking/sharpe_weight"_json_pointer, 0.35);
     double      mddW      = sweepCfg.value("/ranking/mdd_weight"_json_pointer, 0.30);
+    std::string outPath   = sweepCfg.value("/output/results_file"_json_pointer, std::string("macro_sweep.bin"));
+    bool        printGrid = sweepCfg.value("/output/print_tables"_json_pointer, true);
+    size_t      topK      = sweepCfg.value("/output/top_k"_json_pointer, static_cast<size_t>(0));  // 0 = all
 
     /* ---- Find widest date range ---- */
     std::string globalStart = periods[0].start;
@@ -216,8 +212,12 @@ int main(int argc, char* argv[]) {
 
     std::cerr << "Fetching FRED data (" << warmupDate << " ~ " << globalEnd << ")..." << std::endl;
     std::map<std::string, std::shared_ptr<FredSeriesInfo>> fredDataFull;
+    // Histories are archived locally and re-fetched at most once a day
+    const SeriesArchive archive("archive");
     for (const auto& id : fredIds) {
-        auto result = yFinance::getFredSeries(id, apiKey, warmupDate, globalEnd, "m");
+        auto result = archive.fredSeries(id, "m", warmupDate, globalEnd, civil::kSecondsPerDay, [&] {
+            return yFinance::getFredSeries(id, apiKey, warmupDate, globalEnd, "m");
+        });
         if (result && !result->values.empty()) {
             fredDataFull[id] = result;
             std::cerr << "  [OK] " << id << " (" << result->values.size() << " obs)" << std::endl;
@@ -225,6 +225,7 @@ int main(int argc, char* argv[]) {
             std::cerr << "  [WARN] " << id << " - no data" << std::endl;
         }
     }
+    const auto fredTable = MacroScorer::toSeriesTable(fredDataFull);
 
     /* ---- Fetch all unique tickers across portfolios (once) ---- */
     std::cerr << "Fetching asset prices..." << std::endl;
@@ -254,14 +255,22 @@ int main(int argc, char* argv[]) {
     std::cerr << "Running 3D sweep (" << portfolios.size() << " portfolios × " << strategies.size() << " strategies × "
               << periods.size() << " periods)..." << std::endl;
 
-    // results[portfolioIdx][strategyIdx][periodIdx]
-    using Grid3D = std::vector<std::vector<std::vector<SweepCell>>>;
-    Grid3D results(portfolios.size(),
-                   std::vector<std::vector<SweepCell>>(strategies.size(), std::vector<SweepCell>(periods.size())));
+    // Cells are streamed to disk as they complete, so memory does not grow with the grid
+    std::vector<std::string> portfolioNames, strategyNames, periodNames;
+    for (const auto& pf : portfolios)
+        portfolioNames.push_back(pf.name);
+    for (const auto& st : strategies)
+        strategyNames.push_back(st.name);
+    for (const auto& p : periods)
+        periodNames.push_back(p.name);
+
+    SweepResultsWriter writer(outPath, portfolioNames, strategyNames, periodNames);
+    if (!writer.ok()) {
+        return 1;
+    }
 
-    // benchmarkResults[periodIdx] — same across all portfolios
-    std::vector<SweepCell> benchResults(periods.size());
-    bool                   benchComputed = false;
+    // Benchmark cells are the same across all portfolios; written once per period
+    bool benchComputed = false;
 
     for (size_t pfi = 0; pfi < portfolios.size(); ++pfi) {
         const auto& pf = portfolios[pfi];
@@ -280,10 +289,16 @@ int main(int argc, char* argv[]) {
 
             // Benchmark (compute once)
             if (!benchComputed) {
-                auto br                 = MacroBacktester::computeBenchmark(benchReturns, dates, benchmark, capital);
-                benchResults[pi].cagr   = br.cagr;
-                benchResults[pi].sharpe = br.sharpeRatio;
-                benchResults[pi].mdd    = br.maxDrawdownPct;
+                auto        br = MacroBacktester::computeBenchmark(benchReturns, dates, benchmark, capital);
+                SweepRecord cell;
+                cell.portfolio      = SweepRecord::kBenchmark;
+                cell.strategy       = SweepRecord::kBenchmark;
+                cell.period         = static_cast<uint32_t>(pi);
+                cell.cagr           = br.cagr;
+                cell.sharpe         = br.sharpeRatio;
+                cell.mdd            = br.maxDrawdownPct;
+                cell.totalReturnPct = br.totalReturnPct;
+                writer.append(cell);
             }
 
             // Build asset returns for this portfolio + period
@@ -302,27 +317,53 @@ int main(int argc, char* argv[]) {
                 }
                 assetReturns[key] = returns;
             }
+            const auto assetTable = MacroBacktester::toReturnTable(assetReturns);
 
             // Run each strategy
             for (size_t si = 0; si < strategies.size(); ++si) {
-                auto r =
-                    MacroBacktester::run(strategies[si].config, fredDataFull, assetReturns, dates, frequency, capital);
-                results[pfi][si][pi].cagr   = r.cagr;
-                results[pfi][si][pi].sharpe = r.sharpeRatio;
-                results[pfi][si][pi].mdd    = r.maxDrawdownPct;
+                auto r = MacroBacktester::run(strategies[si].config, fredTable, assetTable, dates, frequency, capital);
+                SweepRecord cell;
+                cell.portfolio      = static_cast<uint32_t>(pfi);
+                cell.strategy       = static_cast<uint32_t>(si);
+                cell.period         = static_cast<uint32_t>(pi);
+                cell.rebalanceCount = static_cast<uint32_t>(r.rebalanceCount);
+                cell.cagr           = r.cagr;
+                cell.sharpe         = r.sharpeRatio;
+                cell.mdd            = r.maxDrawdownPct;
+                cell.totalReturnPct = r.totalReturnPct;
+                writer.append(cell);
             }
         }
         benchComputed = true;
     }
+    writer.flush();
 
     /* =============== OUTPUT =============== */
 
+    const auto results = SweepResults::open(outPath);
+    if (results.portfolios().size() != portfolios.size() || results.strategies().size() != strategies.size()) {
+        std::cerr << "Error: Cannot read results: " << outPath << std::endl;
+        return 1;
+    }
+    std::cerr << "Wrote " << results.size() << " cells to " << outPath << std::endl;
+
     const int nameW   = 14;
     const int metricW = 8;
     const int periodW = metricW * 3 + 2;
 
-    // Helper to print one strategy × period matrix
-    auto printMatrix = [&](const std::vector<std::vector<SweepCell>>& grid) {
+    // Helper to print one portfolio's strategy × period matrix (one pass over the mapped cells)
+    auto printMatrix = [&](size_t portfolio) {
+        std::vector<std::vector<SweepRecord>> grid(strategies.size(), std::vector<SweepRecord>(periods.size()));
+        std::vector<SweepRecord>              benchCells(periods.size());
+        for (const auto& r : results) {
+            if (r.period >= periods.size())
+                continue;
+            if (r.portfolio == portfolio && r.strategy < strategies.size())
+                grid[r.strategy][r.period] = r;
+            else if (r.strategy == SweepRecord::kBenchmark)
+                benchCells[r.period] = r;
+        }
+
         // Header: period names
         std::clog << std::left << std::setw(nameW) << "Strategy";
         for (const auto& p : periods) {
@@ -344,7 +385,7 @@ int main(int argc, char* argv[]) {
         int totalW = nameW + static_cast<int>(periods.size()) * (periodW + 2);
         std::clog << std::string(totalW, '-') << std::endl;
 
-        auto printRow = [&](const std::string& label, const std::vector<SweepCell>& cells) {
+        auto printRow = [&](const std::string& label, const std::vector<SweepRecord>& cells) {
             std::clog << std::left << std::setw(nameW) << label;
             for (const auto& c : cells) {
                 std::clog << std::right << std::fixed << std::setprecision(1) << std::setw(metricW - 1) << c.cagr << "%"
@@ -359,11 +400,11 @@ int main(int argc, char* argv[]) {
             printRow(strategies[si].name, grid[si]);
         }
         std::clog << std::string(totalW, '-') << std::endl;
-        printRow(benchmark + " (B&H)", benchResults);
+        printRow(benchmark + " (B&H)", benchCells);
     };
 
     // Print per-portfolio detail tables
-    for (size_t pfi = 0; pfi < portfolios.size(); ++pfi) {
+    for (size_t pfi = 0; printGrid && pfi < portfolios.size(); ++pfi) {
         std::clog << std::endl;
         std::clog << "=== Portfolio: " << portfolios[pfi].name << " ===" << std::endl;
 
@@ -374,7 +415,7 @@ int main(int argc, char* argv[]) {
         }
         std::clog << std::endl << std::endl;
 
-        printMatrix(results[pfi]);
+        printMatrix(pfi);
     }
 
     /* ---- Compute per-portfolio ranking ---- */
@@ -383,6 +424,8 @@ int main(int argc, char* argv[]) {
 
     std::vector<PortfolioRank> ranks(portfolios.size());
 
+    const auto summaries = results.summarize();
+
     for (size_t pfi = 0; pfi < portfolios.size(); ++pfi) {
         ranks[pfi].name     = portfolios[pfi].name;
         ranks[pfi].worstMdd = 0.0;
@@ -391,32 +434,18 @@ int main(int argc, char* argv[]) {
         std::string bestStratName;
 
         for (size_t si = 0; si < strategies.size(); ++si) {
-            // Compute this strategy's score across all periods for this portfolio
-            double stratScore   = 0.0;
-            double sumCagr      = 0.0;
-            double sumSharpe    = 0.0;
-            double stratWorstDD = 0.0;
-
-            for (size_t pi = 0; pi < periods.size(); ++pi) {
-                const auto& cell = results[pfi][si][pi];
-                sumCagr += cell.cagr;
-                sumSharpe += cell.sharpe;
-                stratWorstDD = std::min(stratWorstDD, cell.mdd);
-            }
-
-            // Normalize across periods (simple: use raw averages for scoring)
-            double avgC = sumCagr / static_cast<double>(periods.size());
-            double avgS = sumSharpe / static_cast<double>(periods.size());
+            // This strategy's averages across all periods for this portfolio
+            const auto& sum = summaries[pfi * strategies.size() + si];
 
             // Score: higher cagr & sharpe is better, less negative mdd is better
-            stratScore = avgC * cagrW + avgS * 100.0 * sharpeW + (100.0 + stratWorstDD) * mddW;
+            double stratScore = sum.avgCagr * cagrW + sum.avgSharpe * 100.0 * sharpeW + (100.0 + sum.worstMdd) * mddW;
 
             if (stratScore > bestStrategyScore) {
                 bestStrategyScore    = stratScore;
                 bestStratName        = strategies[si].name;
-                ranks[pfi].avgCagr   = avgC;
-                ranks[pfi].avgSharpe = avgS;
-                ranks[pfi].worstMdd  = stratWorstDD;
+                ranks[pfi].avgCagr   = sum.avgCagr;
+                ranks[pfi].avgSharpe = sum.avgSharpe;
+                ranks[pfi].worstMdd  = sum.worstMdd;
             }
         }
 
@@ -438,7 +467,8 @@ int main(int argc, char* argv[]) {
               << std::setw(12) << "Worst MDD" << std::setw(10) << "Score" << std::endl;
     std::clog << std::string(80, '-') << std::endl;
 
-    for (size_t i = 0; i < ranks.size(); ++i) {
+    const size_t shown = (topK > 0) ? std::min(topK, ranks.size()) : ranks.size();
+    for (size_t i = 0; i < shown; ++i) {
         const auto& r = ranks[i];
         std::clog << std::left << std::setw(6) << ("#" + std::to_string(i + 1)) << std::setw(nameW) << r.name
                   << std::setw(nameW) << r.bestStrategy << std::right << std::fixed << std::setprecision(1)
@@ -1,11 +1,12 @@
 #include <algorithm>
-#include <ctime>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
-#include <map>
 #include <vector>
 
+#include "archive/series_archive.hpp"
+#include "civil_date.hpp"
 #include "indicator.hpp"
 #include "yfinance.hpp"
 
@@ -21,10 +22,7 @@ struct Defer {
 };
 
 inline std::string formatTime(const int64_t timestamp) {
-    const std::time_t t = static_cast<std::time_t>(timestamp);
-    char              mbstr[100];
-    std::strftime(mbstr, sizeof(mbstr), "%Y-%m-%d", std::localtime(&t));
-    return mbstr;
+    return civil::formatDate(timestamp);
 }
 
 int main(int argc, char* argv[]) {
@@ -47,35 +45,36 @@ int main(int argc, char* argv[]) {
     }
 
     std::clog << "Step 2: Fetching Fear & Greed Index historical data..." << std::endl;
-    const auto fng = yFinance::getFearAndGreedIndex();
-    if (!fng) {
-        std::cerr << "Failed to fetch Fear & Greed data." << std::endl;
-        return 1;
+    // Every fetched point is archived locally, so the history grows beyond the
+    // one-year window CNN serves and stays available offline.
+    const SeriesArchive archive("archive");
+
+    auto fng = yFinance::getFearAndGreedIndex();
+    if (fng) {
+        archive.append(*fng);
+    } else {
+        fng = std::make_shared<FearAndGreedInfo>();
     }
 
-    // Map F&G timestamps to dates for easier lookup
-    std::map<std::string, std::string> fngRatingsByDate;
-    for (size_t i = 0; i < fng->timestamps.size(); ++i) {
-        fngRatingsByDate[formatTime(fng->timestamps[i])] = fng->ratings[i];
+    if (!archive.load(*fng) && fng->days.empty()) {
+        std::cerr << "Failed to fetch Fear & Greed data." << std::endl;
+        return 1;
     }
-
-    auto getFngRating = [&](int64_t timestamp) -> std::string {
-        std::string date = formatTime(timestamp);
-        if (fngRatingsByDate.count(date)) {
-            return fngRatingsByDate[date];
-        }
-        // Fallback: use the closest previous date
-        auto it = fngRatingsByDate.lower_bound(date);
-        if (it == fngRatingsByDate.end() && !fngRatingsByDate.empty()) {
-            --it;
-        } else if (it != fngRatingsByDate.begin()) {
-            --it;
-        }
-        if (it != fngRatingsByDate.end()) {
-            return it->second;
+    std::clog << "  F&G history: " << fng->days.size() << " days" << std::endl;
+
+    // Align F&G ratings to stock bars once (latest F&G day on or before each bar),
+    // so the simulation loop only compares enum values.
+    std::vector<FngRating> barRatings(stock->timestamps.size(), FngRating::Neutral);
+    if (!fng->days.empty()) {
+        std::size_t j = 0;
+        for (size_t i = 0; i < stock->timestamps.size(); ++i) {
+            const int64_t day = civil::toDays(stock->timestamps[i]);
+            while (j < fng->days.size() && fng->days[j] <= day) {
+                ++j;
+            }
+            barRatings[i] = fng->ratings[(j > 0) ? j - 1 : 0];
         }
-        return "neutral";
-    };
+    }
 
     std::clog << "Step 3: Computing 120-day SMA..." << std::endl;
     const size_t SMA_WINDOW = 120;
@@ -86,18 +85,16 @@ int main(int argc, char* argv[]) {
     double totalInvested = 0.0;
 
     // Find index for START_DATE
-    size_t       startIndex = 0;
-    const time_t startTs    = [](const std::string& date) {
-        std::tm tm = {};
-        strptime(date.c_str(), "%Y-%m-%d", &tm);
-        return timegm(&tm);
-    }(START_DATE);
-
-    for (size_t i = 0; i < stock->timestamps.size(); ++i) {
-        if (stock->timestamps[i] >= (int64_t)startTs) {
-            startIndex = i;
-            break;
-        }
+    int64_t startDay = 0;
+    if (!civil::parseDate(START_DATE, startDay)) {
+        std::cerr << "Invalid start date: " << START_DATE << std::endl;
+        return 1;
+    }
+
+    const size_t startIndex = stock->lowerBound(civil::toTimestamp(startDay));
+    if (startIndex >= stock->close.size()) {
+        std::cerr << "No data on or after " << START_DATE << std::endl;
+        return 1;
     }
 
     std::clog << "Step 4: Running DCA Simulation from " << formatTime(stock->timestamps[startIndex]) << "..."
@@ -125,10 +122,10 @@ int main(int argc, char* argv[]) {
             currentSma = sma120[i - (SMA_WINDOW - 1)];
         }
 
-        const std::string rating = getFngRating(ts);
+        const FngRating rating = barRatings[i];
 
         int  buyQty        = 1;  // Basic buy
-        bool isExtremeFear = (rating == "extreme fear" || rating == "Extreme Fear");
+        bool isExtremeFear = (rating == FngRating::ExtremeFear);
         bool isBelowSma    = (currentSma > 0 && price < currentSma);
 
         if (isExtremeFear)
@@ -146,8 +143,9 @@ int main(int argc, char* argv[]) {
         // Print every month or so to keep logs clean, or just some updates
         if (i % 60 == 0 || i == startIndex || i == stock->close.size() - 1) {
             std::clog << std::left << std::setw(12) << formatTime(ts) << std::fixed << std::setprecision(2) << "$"
-                      << std::setw(9) << price << "$" << std::setw(9) << currentSma << std::setw(15) << rating
-                      << std::setw(8) << buyQty << "$" << std::setw(11) << totalInvested << std::endl;
+                      << std::setw(9) << price << "$" << std::setw(9) << currentSma << std::setw(15)
+                      << fngRatingToString(rating) << std::setw(8) << buyQty << "$" << std::setw(11) << totalInvested
+                      << std::endl;
         }
     }
 
@@ -1,8 +1,8 @@
-#include <ctime>
 #include <functional>
 #include <iomanip>
 #include <iostream>
 
+#include "civil_date.hpp"
 #include "yfinance.hpp"
 
 struct Defer {
@@ -17,10 +17,9 @@ struct Defer {
 };
 
 inline std::string formatTime(const int64_t timestamp) {
-    const std::time_t t = static_cast<std::time_t>(timestamp);
-    char              mbstr[100];
-    std::strftime(mbstr, sizeof(mbstr), "%Y-%m-%d %H:%M", std::localtime(&t));
-    return mbstr;
+    char buf[16];
+    civil::formatDateTime(timestamp, buf);
+    return std::string(buf, sizeof(buf));
 }
 
 void printHeader() {
@@ -0,0 +1,68 @@
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "backtest/backtest_engine.hpp"
+#include "fixtures.hpp"
+#include "indicator/cache.hpp"
+#include "rsi_strategy.hpp"
+#include "sma_crossover.hpp"
+
+/* range(0): bars. Includes the strategy's init() (indicator precomputation), as in a real run. */
+
+static void BM_BacktestSmaCrossover(benchmark::State& state) {
+    const auto&    data = fixtures::stock(static_cast<std::size_t>(state.range(0)));
+    BacktestEngine engine;
+    for (auto _ : state) {
+        SmaCrossover strategy(20, 50);
+        auto         result = engine.run(strategy, data);
+        benchmark::DoNotOptimize(result.finalCapital);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BacktestSmaCrossover)->Arg(2520)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+static void BM_BacktestRsi(benchmark::State& state) {
+    const auto&    data = fixtures::stock(static_cast<std::size_t>(state.range(0)));
+    BacktestEngine engine;
+    for (auto _ : state) {
+        RsiStrategy strategy(14, 30.0, 70.0);
+        auto        result = engine.run(strategy, data);
+        benchmark::DoNotOptimize(result.finalCapital);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BacktestRsi)->Arg(2520)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+
+/* 200 strategies (150 SMA crossovers, 50 RSI) on one ticker. range(0): bars, range(1): share an IndicatorCache */
+
+static void BM_StrategySweep(benchmark::State& state) {
+    const auto&    data     = fixtures::stock(static_cast<std::size_t>(state.range(0)));
+    const bool     useCache = state.range(1) != 0;
+    BacktestEngine engine;
+    std::size_t    computed = 0;
+    for (auto _ : state) {
+        indicator::IndicatorCache  cache;
+        indicator::IndicatorCache* shared = useCache ? &cache : nullptr;
+
+        std::vector<std::unique_ptr<IStrategy>> strategies;
+        for (std::size_t shortWindow = 5; shortWindow <= 50; shortWindow += 5) {
+            for (std::size_t longWindow = 60; longWindow <= 200; longWindow += 10) {
+                strategies.push_back(std::make_unique<SmaCrossover>(shortWindow, longWindow, shared));
+            }
+        }
+        for (std::size_t period = 2; period < 52; ++period) {
+            strategies.push_back(std::make_unique<RsiStrategy>(period, 30.0, 70.0, shared));
+        }
+
+        for (auto& strategy : strategies) {
+            auto result = engine.run(*strategy, data);
+            benchmark::DoNotOptimize(result.finalCapital);
+        }
+        computed = useCache ? cache.stats().misses : 350;  // two SMAs per crossover + one RSI each without the cache
+    }
+    state.counters["computed"] = static_cast<double>(computed);
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 200);
+}
+BENCHMARK(BM_StrategySweep)->ArgsProduct({{2520, 100000}, {0, 1}})->Unit(benchmark::kMillisecond);
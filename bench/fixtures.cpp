@@ -0,0 +1,198 @@
+#include "fixtures.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+#include "civil_date.hpp"
+
+namespace fixtures {
+
+namespace {
+
+constexpr uint64_t kSeed = 42;
+
+/* Look up or build a cached value keyed by size */
+template <typename T, typename Build>
+const T& cached(std::map<std::size_t, T>& cache, std::size_t key, Build build) {
+    auto it = cache.find(key);
+    if (it == cache.end()) {
+        it = cache.emplace(key, build()).first;
+    }
+    return it->second;
+}
+
+void appendNumber(std::string& out, double value) {
+    char buf[32];
+    const int len = std::snprintf(buf, sizeof(buf), "%.6f", value);
+    out.append(buf, static_cast<std::size_t>(len));
+}
+
+template <typename T>
+void appendArray(std::string& out, const std::vector<T>& values) {
+    out += '[';
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (i > 0) {
+            out += ',';
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            appendNumber(out, values[i]);
+        } else {
+            out += std::to_string(values[i]);
+        }
+    }
+    out += ']';
+}
+
+}  // namespace
+
+const StockInfo& stock(std::size_t bars) {
+    static std::map<std::size_t, StockInfo> cache;
+    return cached(cache, bars, [bars] {
+        return *synthetic::generateStock("SYN", bars, {}, kSeed);
+    });
+}
+
+const synthetic::SyntheticMacro& macro(std::size_t months) {
+    static std::map<std::size_t, synthetic::SyntheticMacro> cache;
+    return cached(cache, months, [months] {
+        synthetic::MacroModel model;
+        model.months = months;
+        return synthetic::generateMacro(model, kSeed);
+    });
+}
+
+const nlohmann::json& macroConfig() {
+    static const nlohmann::json config = [] {
+        std::ifstream file(std::string(YFINANCE_CONFIG_DIR) + "/macro_allocation.json");
+        if (!file.is_open()) {
+            std::cerr << "Cannot open " << YFINANCE_CONFIG_DIR << "/macro_allocation.json" << std::endl;
+            return nlohmann::json::object();
+        }
+        return nlohmann::json::parse(file);
+    }();
+    return config;
+}
+
+const std::string& chartPayload(std::size_t bars) {
+    static std::map<std::size_t, std::string> cache;
+    return cached(cache, bars, [bars] {
+        const auto& data = stock(bars);
+
+        std::string body;
+        body.reserve(bars * 96 + 1024);
+        body += R"({"chart":{"result":[{"meta":{"currency":"USD","symbol":"SYN","exchangeName":"NMS",)";
+        body += R"("instrumentType":"EQUITY","firstTradeDate":)" + std::to_string(data.firstTradeDate);
+        body += R"(,"gmtoffset":-18000,"timezone":"EST","regularMarketPrice":)";
+        appendNumber(body, data.regularMarketPrice);
+        body += R"(,"chartPreviousClose":)";
+        appendNumber(body, data.chartPreviousClose);
+        body += R"(},"timestamp":)";
+        appendArray(body, data.timestamps);
+
+        const int64_t mid = data.timestamps.empty() ? 0 : data.timestamps[data.timestamps.size() / 2];
+        const auto    key = std::to_string(mid);
+        body += R"(,"events":{"dividends":{")" + key + R"(":{"amount":0.25,"date":)" + key + "}},";
+        body += R"("splits":{")" + key + R"(":{"date":)" + key + R"(,"numerator":4,"denominator":1}}})";
+
+        body += R"(,"indicators":{"quote":[{"open":)";
+        appendArray(body, data.open);
+        body += R"(,"high":)";
+        appendArray(body, data.high);
+        body += R"(,"low":)";
+        appendArray(body, data.low);
+        body += R"(,"close":)";
+        appendArray(body, data.close);
+        body += R"(,"volume":)";
+        appendArray(body, data.volume);
+        body += R"(}],"adjclose":[{"adjclose":)";
+        appendArray(body, data.close);
+        body += R"(}]}}],"error":null}})";
+        return body;
+    });
+}
+
+const std::string& fredPayload(std::size_t observations) {
+    static std::map<std::size_t, std::string> cache;
+    return cached(cache, observations, [observations] {
+        const auto& series = *macro(observations).series.at("UNRATE");
+
+        std::string body;
+        body.reserve(observations * 96 + 256);
+        body += R"({"realtime_start":"2025-01-01","realtime_end":"2025-01-01","observation_start":"1600-01-01",)";
+        body += R"("observation_end":"9999-12-31","units":"lin","output_type":1,"file_type":"json",)";
+        body += R"("order_by":"observation_date","sort_order":"asc","count":)" + std::to_string(observations);
+        body += R"(,"offset":0,"limit":100000,"observations":[)";
+        for (std::size_t i = 0; i < series.values.size(); ++i) {
+            if (i > 0) {
+                body += ',';
+            }
+            body += R"({"realtime_start":"2025-01-01","realtime_end":"2025-01-01","date":")" + series.dates[i];
+            body += R"(","value":")";
+            appendNumber(body, series.values[i]);
+            body += R"("})";
+        }
+        body += "]}";
+        return body;
+    });
+}
+
+const std::string& fngPayload(std::size_t days) {
+    static std::map<std::size_t, std::string> cache;
+    return cached(cache, days, [days] {
+        static constexpr const char* kRatings[] = {"extreme fear", "fear", "neutral", "greed", "extreme greed"};
+
+        synthetic::Rng      rng(kSeed);
+        std::vector<double> scores(days);
+        rng.fillUniform(scores.data(), days);
+
+        std::string body;
+        body.reserve(days * 64 + 512);
+        body += R"({"fear_and_greed":{"score":52.3,"rating":"neutral","timestamp":"2025-01-01T00:00:00+00:00",)";
+        body += R"("previous_close":51.0,"previous_1_week":48.2,"previous_1_month":60.1,"previous_1_year":40.7},)";
+        body += R"("fear_and_greed_historical":{"timestamp":1735689600000,"score":52.3,"rating":"neutral","data":[)";
+
+        const int64_t start = civil::toTimestamp(civil::daysFromCivil(2000, 1, 1));
+        for (std::size_t i = 0; i < days; ++i) {
+            if (i > 0) {
+                body += ',';
+            }
+            const double score = 100.0 * scores[i];
+            body += R"({"x":)" + std::to_string((start + static_cast<int64_t>(i) * civil::kSecondsPerDay) * 1000);
+            body += R"(,"y":)";
+            appendNumber(body, score);
+            body += R"(,"rating":")";
+            body += kRatings[std::min<std::size_t>(static_cast<std::size_t>(score / 20.0), 4)];
+            body += R"("})";
+        }
+        body += "]}}";
+        return body;
+    });
+}
+
+const std::string& recordedPayload(const std::string& name) {
+    static std::map<std::string, std::string> cache;
+
+    auto it = cache.find(name);
+    if (it == cache.end()) {
+        std::string body;
+        if (const char* dir = std::getenv("YFINANCE_BENCH_DATA")) {
+            std::ifstream file(std::string(dir) + "/" + name, std::ios::binary);
+            if (file.is_open()) {
+                std::ostringstream ss;
+                ss << file.rdbuf();
+                body = ss.str();
+            }
+        }
+        it = cache.emplace(name, std::move(body)).first;
+    }
+    return it->second;
+}
+
+}  // namespace fixtures
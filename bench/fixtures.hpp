@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+#include "stock_info.hpp"
+#include "synthetic.hpp"
+
+/**
+ * @brief Shared, lazily built inputs for the benchmarks.
+ *
+ * Everything is generated from fixed seeds (see synthetic.hpp), so runs are
+ * comparable across machines and releases. Each fixture is built once per
+ * size and cached for the life of the process, outside the timed loops.
+ */
+namespace fixtures {
+
+/**
+ * @brief Daily GBM path of `bars` bars (seed 42).
+ */
+[[nodiscard]] const StockInfo& stock(std::size_t bars);
+
+/**
+ * @brief Regime-switching FRED series and asset returns covering `months` months (seed 42).
+ */
+[[nodiscard]] const synthetic::SyntheticMacro& macro(std::size_t months);
+
+/**
+ * @brief config/macro_allocation.json of the source tree.
+ */
+[[nodiscard]] const nlohmann::json& macroConfig();
+
+/**
+ * @brief Yahoo chart API body for stock(bars), with a dividend and a split event.
+ */
+[[nodiscard]] const std::string& chartPayload(std::size_t bars);
+
+/**
+ * @brief FRED series/observations body of `observations` monthly values.
+ */
+[[nodiscard]] const std::string& fredPayload(std::size_t observations);
+
+/**
+ * @brief CNN Fear and Greed graphdata body with `days` historical points.
+ */
+[[nodiscard]] const std::string& fngPayload(std::size_t days);
+
+/**
+ * @brief A captured response body, read from $YFINANCE_BENCH_DATA/<name> (e.g. "chart.json").
+ * @return An empty string if the variable is unset or the file is missing.
+ */
+[[nodiscard]] const std::string& recordedPayload(const std::string& name);
+
+}  // namespace fixtures
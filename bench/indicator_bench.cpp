@@ -0,0 +1,393 @@
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "fixtures.hpp"
+#include "indicator.hpp"
+#include "indicator/batch.hpp"
+#include "indicator/drawdown.hpp"
+#include "indicator/expr.hpp"
+#include "indicator/features.hpp"
+#include "indicator/gaps.hpp"
+#include "indicator/simd.hpp"
+#include "indicator/state.hpp"
+
+/* range(0): bars, range(1): window / period */
+
+static void BM_Sma(benchmark::State& state) {
+    const auto& close  = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    const auto  window = static_cast<std::size_t>(state.range(1));
+    for (auto _ : state) {
+        auto result = indicator::sma(close, window);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Sma)->ArgsProduct({{1000, 100000, 1000000}, {20, 200}});
+
+static void BM_Rsi(benchmark::State& state) {
+    const auto& close  = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    const auto  period = static_cast<std::size_t>(state.range(1));
+    for (auto _ : state) {
+        auto result = indicator::rsi(close, period);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Rsi)->ArgsProduct({{1000, 100000, 1000000}, {14, 50}});
+
+/* Aligned variants into a reused buffer, against BM_Sma / BM_Rsi. range(0): bars, range(1): window / period */
+
+static void BM_SmaInto(benchmark::State& state) {
+    const auto&         close  = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    const auto          window = static_cast<std::size_t>(state.range(1));
+    std::vector<double> out;
+    for (auto _ : state) {
+        indicator::smaInto(close, window, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SmaInto)->ArgsProduct({{1000, 100000, 1000000}, {20, 200}});
+
+static void BM_RsiInto(benchmark::State& state) {
+    const auto&         close  = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    const auto          period = static_cast<std::size_t>(state.range(1));
+    std::vector<double> out;
+    for (auto _ : state) {
+        indicator::rsiInto(close, period, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RsiInto)->ArgsProduct({{1000, 100000, 1000000}, {14, 50}});
+
+/* Rolling extrema and drawdowns. range(0): bars, range(1): window */
+
+static void BM_RollingMax(benchmark::State& state) {
+    const auto& close  = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    const auto  window = static_cast<std::size_t>(state.range(1));
+    for (auto _ : state) {
+        auto result = indicator::rollingMax(close, window);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RollingMax)->ArgsProduct({{100000, 1000000}, {20, 250}});
+
+static void BM_DrawdownStats(benchmark::State& state) {
+    const auto& close = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    for (auto _ : state) {
+        auto stats = indicator::drawdownStats(close);
+        benchmark::DoNotOptimize(stats);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DrawdownStats)->Arg(100000)->Arg(1000000);
+
+/* Window families over the 2..250 grid, against one single-window call per window. range(0): bars */
+
+static void BM_SmaPerWindow(benchmark::State& state) {
+    const auto& close   = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    const auto  windows = indicator::windowRange(2, 250);
+    for (auto _ : state) {
+        for (const auto window : windows) {
+            auto result = indicator::sma(close, window);
+            benchmark::DoNotOptimize(result.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(windows.size()));
+}
+BENCHMARK(BM_SmaPerWindow)->Arg(1000)->Arg(5000);
+
+template <typename Family>
+static void familyGrid(benchmark::State& state, Family family) {
+    const auto&                close   = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    const auto                 windows = indicator::windowRange(2, 250);
+    indicator::IndicatorMatrix matrix;
+    for (auto _ : state) {
+        family(close, windows, matrix);
+        benchmark::DoNotOptimize(matrix.values.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(windows.size()));
+}
+
+using Windows = std::vector<std::size_t>;
+
+static void BM_SmaFamily(benchmark::State& state) {
+    familyGrid(state, [](const std::vector<double>& p, const Windows& w, indicator::IndicatorMatrix& m) {
+        indicator::smaFamily(p, w, m);
+    });
+}
+BENCHMARK(BM_SmaFamily)->Arg(1000)->Arg(5000);
+
+static void BM_SmaFamilyPrefix(benchmark::State& state) {
+    familyGrid(state, [](const std::vector<double>& p, const Windows& w, indicator::IndicatorMatrix& m) {
+        indicator::smaFamily(p, w, m, indicator::SmaFamilyMode::Prefix);
+    });
+}
+BENCHMARK(BM_SmaFamilyPrefix)->Arg(1000)->Arg(5000);
+
+static void BM_EmaFamily(benchmark::State& state) {
+    familyGrid(state, [](const std::vector<double>& p, const Windows& w, indicator::IndicatorMatrix& m) {
+        indicator::emaFamily(p, w, m);
+    });
+}
+BENCHMARK(BM_EmaFamily)->Arg(1000)->Arg(5000);
+
+static void BM_RsiFamily(benchmark::State& state) {
+    familyGrid(state, [](const std::vector<double>& p, const Windows& w, indicator::IndicatorMatrix& m) {
+        indicator::rsiFamily(p, w, m);
+    });
+}
+BENCHMARK(BM_RsiFamily)->Arg(1000)->Arg(5000);
+
+/* Compile-time windows, against BM_Sma / BM_Rsi at the same window. range(0): bars */
+
+template <std::size_t N>
+static void BM_SmaFixed(benchmark::State& state) {
+    const auto& close = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    for (auto _ : state) {
+        auto result = indicator::sma<N>(close);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_SmaFixed, 20)->Arg(1000)->Arg(100000)->Arg(1000000);
+BENCHMARK_TEMPLATE(BM_SmaFixed, 200)->Arg(1000)->Arg(100000)->Arg(1000000);
+
+template <std::size_t N>
+static void BM_RsiFixed(benchmark::State& state) {
+    const auto& close = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    for (auto _ : state) {
+        auto result = indicator::rsi<N>(close);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_RsiFixed, 14)->Arg(1000)->Arg(100000)->Arg(1000000);
+BENCHMARK_TEMPLATE(BM_RsiFixed, 50)->Arg(1000)->Arg(100000)->Arg(1000000);
+
+/* Streaming states: one tick across a universe. range(0): symbols */
+
+template <typename State>
+static void streamingTick(benchmark::State& state, const State& initial) {
+    const auto  symbols = static_cast<std::size_t>(state.range(0));
+    const auto& close   = fixtures::stock(symbols + 1024).close;
+
+    std::vector<State> states(symbols, initial);
+    for (std::size_t s = 0; s < symbols; ++s) {
+        states[s].warmUp(close.data() + s, 1000);
+    }
+
+    std::size_t tick = 1000;
+    for (auto _ : state) {
+        double total = 0.0;
+        for (std::size_t s = 0; s < symbols; ++s) {
+            states[s].update(close[s + tick]);
+            total += states[s].value();
+        }
+        benchmark::DoNotOptimize(total);
+        tick = tick + 1 == 1024 ? 1000 : tick + 1;
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+static void BM_SmaStateTick(benchmark::State& state) {
+    streamingTick(state, indicator::SmaState(20));
+}
+BENCHMARK(BM_SmaStateTick)->Arg(50000);
+
+static void BM_RsiStateTick(benchmark::State& state) {
+    streamingTick(state, indicator::RsiState(14));
+}
+BENCHMARK(BM_RsiStateTick)->Arg(50000);
+
+static void BM_FixedSmaStateTick(benchmark::State& state) {
+    streamingTick(state, indicator::FixedSmaState<20>{});
+}
+BENCHMARK(BM_FixedSmaStateTick)->Arg(50000);
+
+static void BM_FixedRsiStateTick(benchmark::State& state) {
+    streamingTick(state, indicator::FixedRsiState<14>{});
+}
+BENCHMARK(BM_FixedRsiStateTick)->Arg(50000);
+
+static void BM_EmaStateTick(benchmark::State& state) {
+    streamingTick(state, indicator::EmaState(20));
+}
+BENCHMARK(BM_EmaStateTick)->Arg(50000);
+
+static void BM_VarianceStateTick(benchmark::State& state) {
+    streamingTick(state, indicator::VarianceState(20));
+}
+BENCHMARK(BM_VarianceStateTick)->Arg(50000);
+
+/* Every feature of the default FeatureConfig in one pass. range(0): bars */
+
+static void BM_ComputeFeatures(benchmark::State& state) {
+    const auto& data = fixtures::stock(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        auto features = indicator::computeFeatures(data);
+        benchmark::DoNotOptimize(features.obv.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ComputeFeatures)->Arg(1000)->Arg(100000);
+
+/* Composite signals: lazily fused expression vs. materializing each stage. range(0): bars */
+
+static void BM_SpreadMaterialized(benchmark::State& state) {
+    const auto& close = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    for (auto _ : state) {
+        const auto fast = indicator::sma(close, 20);
+        const auto slow = indicator::sma(close, 50);
+
+        std::vector<double> spread(slow.size());
+        for (std::size_t j = 0; j < slow.size(); ++j) {
+            spread[j] = fast[j + 30] - slow[j];
+        }
+        benchmark::DoNotOptimize(spread.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpreadMaterialized)->Arg(100000)->Arg(1000000);
+
+static void BM_SpreadExpr(benchmark::State& state) {
+    const auto& data   = fixtures::stock(static_cast<std::size_t>(state.range(0)));
+    const auto  spread = indicator::expr::close().sma(20) - indicator::expr::close().sma(50);
+    for (auto _ : state) {
+        auto result = indicator::expr::evaluate(spread, data);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpreadExpr)->Arg(100000)->Arg(1000000);
+
+static void BM_ZScoreMaterialized(benchmark::State& state) {
+    const auto& close = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    for (auto _ : state) {
+        const auto mean     = indicator::sma(close, 20);
+        const auto variance = indicator::variance(close, 20);
+
+        std::vector<double> deviation(mean.size());
+        for (std::size_t j = 0; j < mean.size(); ++j) {
+            deviation[j] = close[j + 19] - mean[j];
+        }
+        std::vector<double> stddev(variance.size());
+        for (std::size_t j = 0; j < variance.size(); ++j) {
+            stddev[j] = std::sqrt(variance[j]);
+        }
+        std::vector<double> zscore(mean.size());
+        for (std::size_t j = 0; j < mean.size(); ++j) {
+            zscore[j] = deviation[j] / stddev[j];
+        }
+        benchmark::DoNotOptimize(zscore.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ZScoreMaterialized)->Arg(100000)->Arg(1000000);
+
+static void BM_ZScoreExpr(benchmark::State& state) {
+    const auto& data   = fixtures::stock(static_cast<std::size_t>(state.range(0)));
+    const auto  close  = indicator::expr::close();
+    const auto  zscore = (close - close.sma(20)) / close.stddev(20);
+    for (auto _ : state) {
+        auto result = indicator::expr::evaluate(zscore, data);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ZScoreExpr)->Arg(100000)->Arg(1000000);
+
+/* Gap-aware SMA with one missing bar per 1000. range(0): bars, range(1): GapPolicy */
+
+static void BM_SmaGaps(benchmark::State& state) {
+    auto close = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    for (std::size_t i = 500; i < close.size(); i += 1000) {
+        close[i] = std::numeric_limits<double>::quiet_NaN();
+    }
+    const auto policy = static_cast<indicator::GapPolicy>(state.range(1));
+    for (auto _ : state) {
+        auto result = indicator::sma(close, 20, policy);
+        benchmark::DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SmaGaps)->ArgsProduct({{100000, 1000000}, {0, 1, 2}});
+
+/* Vectorized kernels per dispatch target. range(0): bars, range(1): Isa, range(2): window / period */
+
+static bool selectIsa(benchmark::State& state, int64_t isa) {
+    const auto wanted = static_cast<indicator::simd::Isa>(isa);
+    if (indicator::simd::setIsa(wanted) != wanted) {
+        state.SkipWithError("ISA not supported by this CPU");
+        return false;
+    }
+    state.SetLabel(indicator::simd::isaName(wanted));
+    return true;
+}
+
+static void BM_SimdSma(benchmark::State& state) {
+    const auto& close  = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    const auto  window = static_cast<std::size_t>(state.range(2));
+    if (!selectIsa(state, state.range(1))) {
+        return;
+    }
+    std::vector<double> out(close.size() - window + 1);
+    for (auto _ : state) {
+        indicator::simd::sma(close.data(), close.size(), window, out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    indicator::simd::setIsa(indicator::simd::detectedIsa());
+}
+BENCHMARK(BM_SimdSma)->ArgsProduct({{100000, 1000000}, {0, 1, 2, 3}, {20}});
+
+static void BM_SimdRsi(benchmark::State& state) {
+    const auto& close  = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    const auto  period = static_cast<std::size_t>(state.range(2));
+    if (!selectIsa(state, state.range(1))) {
+        return;
+    }
+    std::vector<double> out(close.size() - period);
+    for (auto _ : state) {
+        indicator::simd::rsi(close.data(), close.size(), period, out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    indicator::simd::setIsa(indicator::simd::detectedIsa());
+}
+BENCHMARK(BM_SimdRsi)->ArgsProduct({{100000, 1000000}, {0, 1, 2, 3}, {14}});
+
+static void BM_SimdReturns(benchmark::State& state) {
+    const auto& close = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    if (!selectIsa(state, state.range(1))) {
+        return;
+    }
+    std::vector<double> out(close.size() - 1);
+    for (auto _ : state) {
+        indicator::simd::returns(close.data(), close.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    indicator::simd::setIsa(indicator::simd::detectedIsa());
+}
+BENCHMARK(BM_SimdReturns)->ArgsProduct({{100000, 1000000}, {0, 1, 2, 3}});
+
+static void BM_SimdLogReturns(benchmark::State& state) {
+    const auto& close = fixtures::stock(static_cast<std::size_t>(state.range(0))).close;
+    if (!selectIsa(state, state.range(1))) {
+        return;
+    }
+    std::vector<double> out(close.size() - 1);
+    for (auto _ : state) {
+        indicator::simd::logReturns(close.data(), close.size(), out.data());
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    indicator::simd::setIsa(indicator::simd::detectedIsa());
+}
+BENCHMARK(BM_SimdLogReturns)->ArgsProduct({{100000, 1000000}, {0, 1, 2, 3}});
@@ -0,0 +1,45 @@
+#include <benchmark/benchmark.h>
+
+#include "fixtures.hpp"
+#include "macro/macro_backtester.hpp"
+#include "macro_scorer.hpp"
+
+/* range(0): months */
+
+static void BM_ComputeScoresAt(benchmark::State& state) {
+    const auto  months = static_cast<std::size_t>(state.range(0));
+    const auto  table  = MacroScorer::toSeriesTable(fixtures::macro(months).series);
+    std::size_t index  = 0;
+    for (auto _ : state) {
+        auto scores = MacroScorer::computeScoresAt(table, index);
+        benchmark::DoNotOptimize(scores.composite);
+        index = index + 1 < months ? index + 1 : 0;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ComputeScoresAt)->Arg(360)->Arg(1200);
+
+static void BM_MacroBacktest(benchmark::State& state) {
+    const auto& macro   = fixtures::macro(static_cast<std::size_t>(state.range(0)));
+    const auto& config  = fixtures::macroConfig();
+    const auto  fred    = MacroScorer::toSeriesTable(macro.series);
+    const auto  returns = MacroBacktester::toReturnTable(macro.assetReturns);
+    for (auto _ : state) {
+        auto result = MacroBacktester::run(config, fred, returns, macro.dates, "m");
+        benchmark::DoNotOptimize(result.finalCapital);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MacroBacktest)->Arg(360)->Arg(1200)->Unit(benchmark::kMicrosecond);
+
+/* Map overload: includes the per-call interning of series and asset keys */
+static void BM_MacroBacktestMap(benchmark::State& state) {
+    const auto& macro  = fixtures::macro(static_cast<std::size_t>(state.range(0)));
+    const auto& config = fixtures::macroConfig();
+    for (auto _ : state) {
+        auto result = MacroBacktester::run(config, macro.series, macro.assetReturns, macro.dates, "m");
+        benchmark::DoNotOptimize(result.finalCapital);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MacroBacktestMap)->Arg(360)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include "arena.hpp"
+#include "fixtures.hpp"
+#include "yfinance.hpp"
+
+/*
+ * range(0): bars / observations / days of the generated payload.
+ * The *Recorded cases decode captured responses from $YFINANCE_BENCH_DATA
+ * (chart.json, fred.json, fng.json); each is registered only if its file is there.
+ */
+
+static void parseChart(benchmark::State& state, const std::string& body, ParseArena* arena = nullptr) {
+    StockInfo out;
+    for (auto _ : state) {
+        const auto status = arena ? yFinance::parseStockInfo(body, "SYN", out, *arena)
+                                  : yFinance::parseStockInfo(body, "SYN", out);
+        if (status != FetchStatus::Ok) {
+            state.SkipWithError("parse failed");
+            break;
+        }
+        benchmark::DoNotOptimize(out.close.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(body.size()));
+}
+
+static void parseFred(benchmark::State& state, const std::string& body) {
+    FredSeriesInfo out;
+    for (auto _ : state) {
+        if (yFinance::parseFredSeries(body, "UNRATE", out) != FetchStatus::Ok) {
+            state.SkipWithError("parse failed");
+            break;
+        }
+        benchmark::DoNotOptimize(out.values.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(body.size()));
+}
+
+static void parseFng(benchmark::State& state, const std::string& body) {
+    FearAndGreedInfo out;
+    for (auto _ : state) {
+        if (yFinance::parseFearAndGreed(body, out) != FetchStatus::Ok) {
+            state.SkipWithError("parse failed");
+            break;
+        }
+        benchmark::DoNotOptimize(out.scores.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(body.size()));
+}
+
+static void BM_ParseChart(benchmark::State& state) {
+    parseChart(state, fixtures::chartPayload(static_cast<std::size_t>(state.range(0))));
+}
+BENCHMARK(BM_ParseChart)->Arg(252)->Arg(2520)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+/* Steady-state refresh: one arena reused across decodes */
+static void BM_ParseChartReusedArena(benchmark::State& state) {
+    const auto body = fixtures::chartPayload(static_cast<std::size_t>(state.range(0)));
+    ParseArena arena(8 * body.size());
+    parseChart(state, body, &arena);
+}
+BENCHMARK(BM_ParseChartReusedArena)->Arg(252)->Arg(2520)->Unit(benchmark::kMicrosecond);
+
+static void BM_ParseFred(benchmark::State& state) {
+    parseFred(state, fixtures::fredPayload(static_cast<std::size_t>(state.range(0))));
+}
+BENCHMARK(BM_ParseFred)->Arg(360)->Arg(10000)->Unit(benchmark::kMicrosecond);
+
+static void BM_ParseFng(benchmark::State& state) {
+    parseFng(state, fixtures::fngPayload(static_cast<std::size_t>(state.range(0))));
+}
+BENCHMARK(BM_ParseFng)->Arg(365)->Arg(5000)->Unit(benchmark::kMicrosecond);
+
+/* Registered at startup so runs without recorded data report no error entries */
+static const bool registeredRecorded = [] {
+    const auto add = [](const char* name, const char* file, void (*parse)(benchmark::State&, const std::string&)) {
+        const auto& body = fixtures::recordedPayload(file);
+        if (!body.empty()) {
+            benchmark::RegisterBenchmark(name, [parse, &body](benchmark::State& state) {
+                parse(state, body);
+            })->Unit(benchmark::kMicrosecond);
+        }
+    };
+    add("BM_ParseChartRecorded", "chart.json", [](benchmark::State& state, const std::string& body) {
+        parseChart(state, body);
+    });
+    add("BM_ParseFredRecorded", "fred.json", parseFred);
+    add("BM_ParseFngRecorded", "fng.json", parseFng);
+    return true;
+}();
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fng_info.hpp"
+#include "fred_info.hpp"
+
+/**
+ * @brief Fixed-size observation record stored in an archive file.
+ */
+struct ArchiveRecord {
+    int32_t day        = 0;  // days since 1970-01-01 (UTC)
+    uint8_t tag        = 0;  // series-specific tag (FngRating for Fear & Greed)
+    uint8_t padding[3] = {};
+    double  value      = 0.0;
+};
+
+static_assert(sizeof(ArchiveRecord) == 16, "ArchiveRecord must stay 16 bytes for the on-disk format");
+
+/**
+ * @brief Read-only memory-mapped view of one archived series.
+ *
+ * The view is valid until the object is destroyed; records are sorted by day.
+ * It holds a shared lock on the file, so merges into the series wait for it.
+ */
+class MappedSeries {
+   public:
+    MappedSeries() = default;
+    ~MappedSeries();
+
+    MappedSeries(const MappedSeries& other) = delete;
+    MappedSeries(MappedSeries&& other) noexcept;
+
+    MappedSeries& operator=(const MappedSeries& other) = delete;
+    MappedSeries& operator=(MappedSeries&& other) noexcept;
+
+    [[nodiscard]] const ArchiveRecord* data() const { return records_; }
+    [[nodiscard]] const ArchiveRecord* begin() const { return records_; }
+    [[nodiscard]] const ArchiveRecord* end() const { return records_ + size_; }
+
+    [[nodiscard]] std::size_t size() const { return size_; }
+    [[nodiscard]] bool        empty() const { return size_ == 0; }
+
+    [[nodiscard]] const ArchiveRecord& operator[](std::size_t i) const { return records_[i]; }
+
+   private:
+    friend class SeriesArchive;
+
+    void release();
+
+    int                  fd_      = -1;
+    void*                base_    = nullptr;
+    std::size_t          length_  = 0;
+    const ArchiveRecord* records_ = nullptr;
+    std::size_t          size_    = 0;
+};
+
+/**
+ * @brief Local archive of fetched observations, one file per series ID.
+ *
+ * Each file is a 16-byte header followed by ArchiveRecords sorted by day.
+ * Appending merges a fetch into the archive by day: new days are added and
+ * archived days whose value changed (a live reading for today, a revised FRED
+ * observation) are rewritten in place, so every fetch can be archived
+ * unconditionally and histories grow beyond the window the remote API serves.
+ * Files are mmap-able and readable offline; a file's modification time is that
+ * of its last merge. Readers take a shared flock and merges an exclusive one.
+ */
+class SeriesArchive {
+   public:
+    /**
+     * @brief Series ID under which the CNN Fear & Greed history is archived.
+     */
+    static constexpr const char* kFearAndGreedId = "FEAR_AND_GREED";
+
+    using FredFetch = std::function<std::shared_ptr<FredSeriesInfo>()>;
+
+    /**
+     * @param directory Archive directory (created if missing).
+     */
+    explicit SeriesArchive(std::string directory);
+
+    /**
+     * @brief Merge records into the archive; a record replaces the archived one of its day.
+     * @param seriesId Series ID (file name stem).
+     * @param records  Records sorted by day (of repeated days, the last one is kept).
+     * @return Number of records added or changed.
+     */
+    std::size_t append(const std::string& seriesId, const std::vector<ArchiveRecord>& records) const;
+
+    /**
+     * @brief Merge a fetched FRED series, archived under its seriesId and frequency
+     *        ("GS10@m" for monthly; the plain ID for the native frequency).
+     */
+    std::size_t append(const FredSeriesInfo& series, const std::string& frequency = "") const;
+
+    /**
+     * @brief Merge a fetched Fear & Greed history (archived under kFearAndGreedId).
+     */
+    std::size_t append(const FearAndGreedInfo& fng) const;
+
+    /**
+     * @brief Map an archived series. Returns an empty view if it does not exist.
+     */
+    [[nodiscard]] MappedSeries open(const std::string& seriesId) const;
+
+    /**
+     * @brief Load an archived FRED series into out.
+     * @return false if the series is not archived.
+     */
+    bool load(const std::string& seriesId, FredSeriesInfo& out, const std::string& frequency = "") const;
+
+    /**
+     * @brief Load the archived Fear & Greed history into out (historical columns only).
+     * @return false if no history is archived.
+     */
+    bool load(FearAndGreedInfo& out) const;
+
+    /**
+     * @brief FRED series over [start, end] ("YYYY-MM-DD", empty for unbounded), served from the archive.
+     *
+     * `fetch` should request the series from `start`. The archive is used as is
+     * if it was merged within `maxAgeSeconds` and a fetch from `start` or earlier
+     * has been merged into it. Otherwise `fetch` is called and its result merged
+     * first; if the fetch fails, the archived history is returned.
+     *
+     * @return nullptr if neither the fetch nor the archive has observations in the range.
+     */
+    [[nodiscard]] std::shared_ptr<FredSeriesInfo> fredSeries(const std::string& seriesId,
+                                                             const std::string& frequency,
+                                                             const std::string& start,
+                                                             const std::string& end,
+                                                             int64_t            maxAgeSeconds,
+                                                             const FredFetch&   fetch) const;
+
+    /**
+     * @brief Path of the archive file of a series.
+     */
+    [[nodiscard]] std::string path(const std::string& seriesId) const;
+
+   private:
+    [[nodiscard]] static std::string fredId(const std::string& seriesId, const std::string& frequency);
+
+    /**
+     * @brief append() that also records a fetch from day `fetchStart` in the file header.
+     */
+    std::size_t merge(const std::string& seriesId, const std::vector<ArchiveRecord>& records, int32_t fetchStart) const;
+
+    /**
+     * @brief Earliest start day of the fetches merged into a series (INT32_MAX if unknown).
+     */
+    [[nodiscard]] int32_t fetchedFrom(const std::string& seriesId) const;
+
+    std::string directory_;
+};
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+/**
+ * @brief Monotonic arena for one response (or one batch of responses).
+ *
+ * Allocation is a pointer bump from thread-private chunks, deallocation is a
+ * no-op, and every byte is returned to the upstream resource in one shot when
+ * the arena is released or destroyed. Decoders running on many fetch threads
+ * therefore never contend on the global allocator for their temporaries.
+ */
+class ParseArena {
+   public:
+    /**
+     * @param initialSize Size of the first chunk requested from upstream.
+     * @param upstream    Resource the chunks come from. Defaults to the arena
+     *                    active on this thread (see ArenaScope), so a
+     *                    per-request arena nests inside a per-batch one.
+     */
+    explicit ParseArena(std::size_t initialSize = 64 * 1024, std::pmr::memory_resource* upstream = nullptr);
+    ~ParseArena();
+
+    ParseArena(const ParseArena& other) = delete;
+    ParseArena& operator=(const ParseArena& other) = delete;
+
+    [[nodiscard]] std::pmr::memory_resource* resource() { return &resource_; }
+
+    /**
+     * @brief Release every allocation made from this arena at once.
+     *
+     * The first chunk is kept, so a reused arena allocates nothing upstream
+     * while each of its responses fits in `initialSize`.
+     */
+    void release() { resource_.release(); }
+
+   private:
+    std::pmr::memory_resource*          upstream_;
+    std::size_t                         initialSize_;
+    void*                               initial_;
+    std::pmr::monotonic_buffer_resource resource_;
+};
+
+/**
+ * @brief Installs an arena as the current allocation source of this thread.
+ *
+ * ArenaAllocator instances default-constructed while the scope is alive draw
+ * from the arena. Scopes nest; the previous arena is restored on destruction.
+ */
+class ArenaScope {
+   public:
+    explicit ArenaScope(ParseArena& arena);
+    ~ArenaScope();
+
+    ArenaScope(const ArenaScope& other) = delete;
+    ArenaScope& operator=(const ArenaScope& other) = delete;
+
+    /**
+     * @brief Arena resource active on this thread, or the default pmr resource.
+     */
+    [[nodiscard]] static std::pmr::memory_resource* current();
+
+   private:
+    std::pmr::memory_resource* previous_;
+};
+
+/**
+ * @brief Stateful allocator bound to the thread's current arena at construction.
+ *
+ * Unlike std::pmr::polymorphic_allocator it is default-constructible into an
+ * arena, which lets it back containers (such as nlohmann::basic_json) that
+ * create their allocators internally.
+ */
+template <typename T>
+class ArenaAllocator {
+   public:
+    using value_type = T;
+
+    ArenaAllocator() noexcept
+        : resource_(ArenaScope::current()) {}
+
+    explicit ArenaAllocator(std::pmr::memory_resource* resource) noexcept
+        : resource_(resource) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept  // NOLINT(google-explicit-constructor)
+        : resource_(other.resource()) {}
+
+    [[nodiscard]] T* allocate(std::size_t n) {
+        return static_cast<T*>(resource_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept { resource_->deallocate(p, n * sizeof(T), alignof(T)); }
+
+    [[nodiscard]] std::pmr::memory_resource* resource() const noexcept { return resource_; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return *resource_ == *other.resource();
+    }
+
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const noexcept {
+        return !(*this == other);
+    }
+
+   private:
+    std::pmr::memory_resource* resource_;
+};
+
+using ArenaString = std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>>;
+
+/**
+ * @brief JSON document whose nodes, arrays, objects and strings live in the current arena.
+ */
+using ArenaJson = nlohmann::basic_json<std::map, std::vector, ArenaString, bool, std::int64_t, std::uint64_t, double,
+                                       ArenaAllocator>;
+
+/**
+ * @brief Copy an arena-backed JSON string out into a regular std::string.
+ */
+[[nodiscard]] inline std::string toStdString(const ArenaJson& node) {
+    const auto& s = node.get_ref<const ArenaString&>();
+    return std::string(s.data(), s.size());
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "backtest/backtest_engine.hpp"
+#include "macro/macro_backtester.hpp"
+#include "stock_info.hpp"
+
+/*
+ * Arrow C Data Interface (https://arrow.apache.org/docs/format/CDataInterface.html).
+ * The structs are ABI-stable and guarded so they coexist with arrow/c/abi.h.
+ */
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+
+struct ArrowSchema {
+    const char*          format;
+    const char*          name;
+    const char*          metadata;
+    int64_t              flags;
+    int64_t              n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema*  dictionary;
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray {
+    int64_t             length;
+    int64_t             null_count;
+    int64_t             offset;
+    int64_t             n_buffers;
+    int64_t             n_children;
+    const void**        buffers;
+    struct ArrowArray** children;
+    struct ArrowArray*  dictionary;
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+
+}  // extern "C"
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+/**
+ * @brief Export library results as Arrow struct arrays (one child per column).
+ *
+ * The exported arrays keep the source object alive through the shared_ptr
+ * until the consumer calls release(); the source must not be modified in the
+ * meantime. Schemas and arrays are filled in place and released independently,
+ * as the C Data Interface requires.
+ */
+class ArrowExport {
+   public:
+    /**
+     * @brief Export the historical columns without copying.
+     *
+     * Columns: timestamps (timestamp[s, UTC]), open, high, low, close (float64),
+     * volume (int64). The schema carries the ticker as "ticker" metadata.
+     * Children point straight into the StockInfo vectors.
+     *
+     * @return false if the columns differ in length (nothing is exported).
+     */
+    static bool exportStockInfo(const std::shared_ptr<const StockInfo>& data, ArrowSchema* schema,
+                                ArrowArray* array);
+
+    /**
+     * @brief Export the trade list.
+     *
+     * Columns: buyIndex, sellIndex (uint64), buyPrice, sellPrice, returnPct (float64).
+     * Trades are stored as an array of structs, so the fields are transposed
+     * into columns once here; the copy is owned by the exported array.
+     */
+    static bool exportTrades(const std::shared_ptr<const BacktestResult>& result, ArrowSchema* schema,
+                             ArrowArray* array);
+
+    /**
+     * @brief Export the rebalancing periods.
+     *
+     * Columns: date, regime, prevRegime (utf8), growth ... composite (float64 scores),
+     * stocks ... cash (float64 weights), allocChanged (bool), equity, monthReturn (float64).
+     * Like trades, periods are transposed into owned columns once.
+     */
+    static bool exportPeriods(const std::shared_ptr<const MacroBacktestResult>& result, ArrowSchema* schema,
+                              ArrowArray* array);
+};
@@ -49,6 +49,10 @@ class BacktestEngine {
 
     /**
      * @brief Run the backtest.
+     *
+     * Bars with a missing (NaN) close, e.g. trading halts, are not traded and
+     * not evaluated; the equity curve carries the last valid value over them.
+     *
      * @param strategy The investment strategy to evaluate.
      * @param data     Historical stock data.
      * @return BacktestResult with all performance metrics and trade list.
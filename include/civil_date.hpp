@@ -0,0 +1,172 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * @brief UTC civil-date arithmetic without libc time functions.
+ *
+ * Days are counted from 1970-01-01 in the proleptic Gregorian calendar.
+ * Conversions use the branch-light era/day-of-era algorithms (H. Hinnant),
+ * take no locks and never consult the TZ database, so they are safe and cheap
+ * in loops over millions of bars.
+ */
+namespace civil {
+
+constexpr int64_t kSecondsPerDay = 86400;
+
+struct CivilDate {
+    int64_t  year  = 1970;
+    unsigned month = 1;  // 1~12
+    unsigned day   = 1;  // 1~31
+};
+
+/**
+ * @brief Number of days in a month of a year.
+ */
+[[nodiscard]] constexpr unsigned daysInMonth(int64_t year, unsigned month) {
+    constexpr unsigned kDays[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    const bool         leap      = (year % 4 == 0) && (year % 100 != 0 || year % 400 == 0);
+    return (month == 2 && leap) ? 29u : kDays[month - 1];
+}
+
+/**
+ * @brief Days since 1970-01-01 of a civil date.
+ */
+[[nodiscard]] constexpr int64_t daysFromCivil(int64_t year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    const int64_t  era = (year >= 0 ? year : year - 399) / 400;
+    const auto     yoe = static_cast<unsigned>(year - era * 400);                        // [0, 399]
+    const unsigned doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;  // [0, 365]
+    const unsigned doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;                          // [0, 146096]
+    return era * 146097 + static_cast<int64_t>(doe) - 719468;
+}
+
+/**
+ * @brief Civil date of a day count since 1970-01-01.
+ */
+[[nodiscard]] constexpr CivilDate civilFromDays(int64_t days) {
+    days += 719468;
+    const int64_t  era = (days >= 0 ? days : days - 146096) / 146097;
+    const auto     doe = static_cast<unsigned>(days - era * 146097);             // [0, 146096]
+    const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;  // [0, 399]
+    const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);                // [0, 365]
+    const unsigned mp  = (5 * doy + 2) / 153;                                    // [0, 11]
+
+    CivilDate date;
+    date.day   = doy - (153 * mp + 2) / 5 + 1;
+    date.month = mp < 10 ? mp + 3 : mp - 9;
+    date.year  = static_cast<int64_t>(yoe) + era * 400 + (date.month <= 2);
+    return date;
+}
+
+/**
+ * @brief Day number of a Unix timestamp (floor division, correct for negatives).
+ */
+[[nodiscard]] constexpr int64_t toDays(int64_t timestamp) {
+    return (timestamp >= 0 ? timestamp : timestamp - (kSecondsPerDay - 1)) / kSecondsPerDay;
+}
+
+/**
+ * @brief Unix timestamp of midnight UTC of a day number.
+ */
+[[nodiscard]] constexpr int64_t toTimestamp(int64_t days) {
+    return days * kSecondsPerDay;
+}
+
+namespace detail {
+
+inline void write2(char* out, unsigned value) {
+    out[0] = static_cast<char>('0' + value / 10);
+    out[1] = static_cast<char>('0' + value % 10);
+}
+
+}  // namespace detail
+
+/**
+ * @brief Write the "YYYY-MM-DD" form of a day number. Writes exactly 10 chars, no terminator.
+ *        Years outside [0, 9999] are wrapped to four digits.
+ */
+inline void formatDays(int64_t days, char* out) {
+    const auto date = civilFromDays(days);
+    const auto year = static_cast<unsigned>(((date.year % 10000) + 10000) % 10000);
+    detail::write2(out, year / 100);
+    detail::write2(out + 2, year % 100);
+    out[4] = '-';
+    detail::write2(out + 5, date.month);
+    out[7] = '-';
+    detail::write2(out + 8, date.day);
+}
+
+/**
+ * @brief Write the "YYYY-MM-DD" UTC date of a Unix timestamp. Writes exactly 10 chars, no terminator.
+ */
+inline void formatDate(int64_t timestamp, char* out) {
+    formatDays(toDays(timestamp), out);
+}
+
+/**
+ * @brief Write the "YYYY-MM-DD HH:MM" UTC time of a Unix timestamp. Writes exactly 16 chars, no terminator.
+ */
+inline void formatDateTime(int64_t timestamp, char* out) {
+    const int64_t days    = toDays(timestamp);
+    const auto    seconds = static_cast<unsigned>(timestamp - days * kSecondsPerDay);
+    formatDays(days, out);
+    out[10] = ' ';
+    detail::write2(out + 11, seconds / 3600);
+    out[13] = ':';
+    detail::write2(out + 14, (seconds / 60) % 60);
+}
+
+/**
+ * @brief "YYYY-MM-DD" UTC date of a Unix timestamp (fits the small-string buffer, no heap allocation).
+ */
+[[nodiscard]] inline std::string formatDate(int64_t timestamp) {
+    char buf[10];
+    formatDate(timestamp, buf);
+    return std::string(buf, sizeof(buf));
+}
+
+/**
+ * @brief Parse the "YYYY-MM-DD" date at the start of `text` into a day number,
+ *        ignoring whatever follows (e.g. the time of a "YYYY-MM-DD HH:MM" field).
+ * @return false if the first 10 chars are not a valid date.
+ */
+[[nodiscard]] inline bool parseDatePrefix(std::string_view text, int64_t& days) {
+    if (text.size() < 10 || text[4] != '-' || text[7] != '-') {
+        return false;
+    }
+
+    unsigned digits[8];
+    const std::size_t pos[8] = {0, 1, 2, 3, 5, 6, 8, 9};
+    unsigned          bad    = 0;
+    for (std::size_t i = 0; i < 8; ++i) {
+        digits[i] = static_cast<unsigned>(text[pos[i]] - '0');
+        bad |= static_cast<unsigned>(digits[i] > 9);
+    }
+    if (bad) {
+        return false;
+    }
+
+    const auto     year  = static_cast<int64_t>(digits[0] * 1000 + digits[1] * 100 + digits[2] * 10 + digits[3]);
+    const unsigned month = digits[4] * 10 + digits[5];
+    const unsigned day   = digits[6] * 10 + digits[7];
+    if (month < 1 || month > 12 || day < 1 || day > daysInMonth(year, month)) {
+        return false;  // rejects e.g. 2023-02-30
+    }
+
+    days = daysFromCivil(year, month, day);
+    return true;
+}
+
+/**
+ * @brief Parse a fixed-width "YYYY-MM-DD" date into a day number.
+ * @return false if the text is not exactly a valid date.
+ */
+[[nodiscard]] inline bool parseDate(std::string_view text, int64_t& days) {
+    return text.size() == 10 && parseDatePrefix(text, days);
+}
+
+}  // namespace civil
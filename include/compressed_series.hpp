@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "stock_info.hpp"
+
+/**
+ * @brief Compressed in-memory column store for StockInfo bars.
+ *
+ * Bars are split into fixed-size blocks that are encoded independently, so any
+ * block can be decoded on its own into a caller-owned scratch StockInfo:
+ *
+ *   - timestamps: delta-of-delta, Gorilla-style variable bit buckets
+ *   - open/high/low/close: Gorilla XOR encoding against the previous value
+ *   - volume: LEB128 varints
+ *
+ * Regular intraday bars typically compress from 48 bytes to a few bytes per bar.
+ */
+class CompressedSeries {
+   public:
+    static constexpr std::size_t kDefaultBlockSize = 1024;
+
+    CompressedSeries() = default;
+
+    /**
+     * @brief Encode the historical columns of a StockInfo.
+     * @param data      Source series. Columns shorter than timestamps are padded with 0.
+     * @param blockSize Bars per independently decodable block.
+     */
+    [[nodiscard]] static CompressedSeries encode(const StockInfo& data, std::size_t blockSize = kDefaultBlockSize);
+
+    /**
+     * @brief Decode one block into scratch, reusing its column capacity.
+     *        Only the historical columns of scratch are touched.
+     */
+    void decodeBlock(std::size_t block, StockInfo& scratch) const;
+
+    /**
+     * @brief Decode every block into out (ticker and columns).
+     */
+    void decode(StockInfo& out) const;
+
+    [[nodiscard]] const std::string& ticker() const { return ticker_; }
+
+    /**
+     * @brief Total number of bars.
+     */
+    [[nodiscard]] std::size_t size() const { return size_; }
+
+    [[nodiscard]] std::size_t blockSize() const { return blockSize_; }
+    [[nodiscard]] std::size_t blockCount() const { return blocks_.size(); }
+
+    /**
+     * @brief Number of bars stored in a block.
+     */
+    [[nodiscard]] std::size_t blockLength(std::size_t block) const { return blocks_[block].count; }
+
+    /**
+     * @brief Encoded payload size in bytes (excluding the block index).
+     */
+    [[nodiscard]] std::size_t bytes() const { return bytes_.size(); }
+
+   private:
+    struct BlockIndex {
+        std::size_t offset = 0;  // byte offset into bytes_
+        uint32_t    count  = 0;  // bars in this block
+    };
+
+    std::string             ticker_;
+    std::size_t             size_      = 0;
+    std::size_t             blockSize_ = kDefaultBlockSize;
+    std::vector<BlockIndex> blocks_;
+    std::vector<uint8_t>    bytes_;
+};
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "stock_info.hpp"
+
+/**
+ * @brief Where one StockInfo column comes from in a CSV file.
+ */
+struct CsvColumn {
+    /**
+     * @brief Header name, matched case-insensitively. Used when index < 0.
+     * @example "Date", "Adj Close", etc.
+     */
+    std::string name = "";
+
+    /**
+     * @brief Zero-based column position. Overrides name when >= 0.
+     */
+    int index = -1;
+};
+
+struct CsvOptions {
+    /**
+     * @brief Ticker stored in the result. Defaults to the file name without extension.
+     */
+    std::string ticker = "";
+
+    char delimiter = ',';
+
+    /**
+     * @brief Whether the first line is a header. Without a header every column must be mapped by index.
+     */
+    bool hasHeader = true;
+
+    /* Column mapping. date and close are required; open/high/low default to close and volume to 0 when unmapped. */
+
+    CsvColumn date   = {"Date"};
+    CsvColumn open   = {"Open"};
+    CsvColumn high   = {"High"};
+    CsvColumn low    = {"Low"};
+    CsvColumn close  = {"Close"};
+    CsvColumn volume = {"Volume"};
+};
+
+/**
+ * @brief Memory-mapped OHLCV CSV import.
+ *
+ * Field boundaries are found 64 bytes at a time with SSE2 compare masks (plain
+ * byte scan on other targets) and numbers are parsed in place with
+ * std::from_chars, so rows are never copied into intermediate strings.
+ *
+ * Dates may be "YYYY-MM-DD", "YYYY-MM-DD HH:MM[:SS]" (or with 'T'), all UTC, or
+ * integer Unix seconds. Rows whose date or close does not parse (e.g. "null")
+ * are skipped. Rows are sorted ascending by time if the file is not.
+ * Quoted fields are unquoted but may not contain the delimiter.
+ */
+class CsvReader {
+   public:
+    /**
+     * @brief Read a CSV file into a new StockInfo.
+     * @return nullptr if the file cannot be read or the columns cannot be mapped.
+     */
+    [[nodiscard]] static std::shared_ptr<StockInfo> load(const std::string& path, const CsvOptions& options = {});
+
+    /**
+     * @brief Read a CSV file into out, reusing its column capacity.
+     * @return false if the file cannot be read or the columns cannot be mapped.
+     */
+    static bool load(const std::string& path, StockInfo& out, const CsvOptions& options = {});
+
+    /**
+     * @brief Parse CSV text already in memory into out, reusing its column capacity.
+     * @return false if the columns cannot be mapped.
+     */
+    static bool parse(std::string_view text, StockInfo& out, const CsvOptions& options = {});
+};
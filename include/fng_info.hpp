@@ -1,8 +1,80 @@
 #pragma once
 
+#include <cctype>
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
+/**
+ * @brief Fear & Greed sentiment rating, decoded once from CNN's label.
+ */
+enum class FngRating : uint8_t
+{
+    Unknown,
+    ExtremeFear,
+    Fear,
+    Neutral,
+    Greed,
+    ExtremeGreed,
+};
+
+/**
+ * @brief Decode a CNN rating label (case-insensitive, e.g. "extreme fear").
+ * @return FngRating::Unknown for unrecognized labels.
+ */
+[[nodiscard]] inline FngRating parseFngRating(std::string_view label) {
+    auto equals = [label](std::string_view expected) {
+        if (label.size() != expected.size()) {
+            return false;
+        }
+        for (std::size_t i = 0; i < label.size(); ++i) {
+            if (std::tolower(static_cast<unsigned char>(label[i])) != expected[i]) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    if (equals("extreme fear")) {
+        return FngRating::ExtremeFear;
+    }
+    if (equals("fear")) {
+        return FngRating::Fear;
+    }
+    if (equals("neutral")) {
+        return FngRating::Neutral;
+    }
+    if (equals("greed")) {
+        return FngRating::Greed;
+    }
+    if (equals("extreme greed")) {
+        return FngRating::ExtremeGreed;
+    }
+    return FngRating::Unknown;
+}
+
+/**
+ * @brief Display label of a rating.
+ */
+[[nodiscard]] inline const char* fngRatingToString(FngRating rating) {
+    switch (rating) {
+    case FngRating::ExtremeFear:
+        return "Extreme Fear";
+    case FngRating::Fear:
+        return "Fear";
+    case FngRating::Neutral:
+        return "Neutral";
+    case FngRating::Greed:
+        return "Greed";
+    case FngRating::ExtremeGreed:
+        return "Extreme Greed";
+    case FngRating::Unknown:
+        break;
+    }
+    return "Unknown";
+}
+
 struct FearAndGreedInfo {
     /**
      * @brief
@@ -54,10 +126,10 @@ struct FearAndGreedInfo {
     /* HISTORICAL DATA */
 
     /**
-     * @brief
-     * @example [1705641600, 1705728000, ...]
+     * @brief Observation days since the Unix epoch (UTC). Multiply by 86400 for a timestamp.
+     * @example [19741, 19742, ...]
      */
-    std::vector<int64_t> timestamps;
+    std::vector<int32_t> days;
 
     /**
      * @brief
@@ -66,8 +138,8 @@ struct FearAndGreedInfo {
     std::vector<double> scores;
 
     /**
-     * @brief
-     * @example ["Neutral", "Fear", ...]
+     * @brief Ratings decoded to enum; use fngRatingToString() for display.
+     * @example [FngRating::Neutral, FngRating::Fear, ...]
      */
-    std::vector<std::string> ratings;
+    std::vector<FngRating> ratings;
 };
@@ -1,56 +1,40 @@
 #pragma once
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <functional>
+#include <limits>
 #include <vector>
 
-namespace indicator {
-
 /**
- * @brief Compute Simple Moving Average (SMA).
- * @param prices  Input price series.
- * @param window  Window size for the moving average.
- * @return        SMA values. Size = prices.size() - window + 1.
- *                An empty vector is returned if prices.size() < window.
+ * @brief Indicators over gap-free series.
+ *
+ * The running sums and averages here assume every bar is a number: a missing
+ * bar (NaN, as yFinance decodes null bars) poisons every value after it. Use
+ * the GapPolicy overloads of indicator/gaps.hpp for series that may have gaps.
  */
-[[nodiscard]] inline std::vector<double> sma(const std::vector<double>& prices, std::size_t window) {
-    if (window == 0 || prices.size() < window) {
-        return {};
-    }
+namespace indicator {
 
-    std::vector<double> result;
-    result.reserve(prices.size() - window + 1);
+namespace detail {
+
+/* Pointer-form kernels shared by the vector-returning and the *Into() functions.
+   The caller checks the sizes; `out` has room for the trimmed result. */
 
+inline void sma(const double* prices, std::size_t n, std::size_t window, double* out) {
     double sum = 0.0;
     for (std::size_t i = 0; i < window; ++i) {
         sum += prices[i];
     }
-    result.push_back(sum / static_cast<double>(window));
+    out[0] = sum / static_cast<double>(window);
 
-    for (std::size_t i = window; i < prices.size(); ++i) {
+    for (std::size_t i = window; i < n; ++i) {
         sum += prices[i] - prices[i - window];
-        result.push_back(sum / static_cast<double>(window));
+        out[i - window + 1] = sum / static_cast<double>(window);
     }
-
-    return result;
 }
 
-/**
- * @brief Compute Relative Strength Index (RSI).
- * @param prices  Input price series.
- * @param period  Lookback period (typically 14).
- * @return        RSI values (0~100). Size = prices.size() - period.
- *                An empty vector is returned if prices.size() <= period.
- *
- * Uses Wilder's smoothing method (exponential moving average of gains/losses).
- */
-[[nodiscard]] inline std::vector<double> rsi(const std::vector<double>& prices, std::size_t period) {
-    if (period == 0 || prices.size() <= period) {
-        return {};
-    }
-
-    std::vector<double> result;
-    result.reserve(prices.size() - period);
-
+inline void rsi(const double* prices, std::size_t n, std::size_t period, double* out) {
     // Calculate initial average gain/loss over the first 'period' changes
     double avgGain = 0.0;
     double avgLoss = 0.0;
@@ -67,17 +51,17 @@ namespace indicator {
 
     // First RSI value
     if (avgLoss < 1e-12) {
-        result.push_back(100.0);
+        out[0] = 100.0;
     } else {
         const double rs = avgGain / avgLoss;
-        result.push_back(100.0 - (100.0 / (1.0 + rs)));
+        out[0]          = 100.0 - (100.0 / (1.0 + rs));
     }
 
     // Subsequent values using Wilder's smoothing
     const double smooth = static_cast<double>(period - 1) / static_cast<double>(period);
     const double inv    = 1.0 / static_cast<double>(period);
 
-    for (std::size_t i = period + 1; i < prices.size(); ++i) {
+    for (std::size_t i = period + 1; i < n; ++i) {
         const double change = prices[i] - prices[i - 1];
         if (change > 0.0) {
             avgGain = avgGain * smooth + change * inv;
@@ -88,14 +72,360 @@ namespace indicator {
         }
 
         if (avgLoss < 1e-12) {
-            result.push_back(100.0);
+            out[i - period] = 100.0;
         } else {
             const double rs = avgGain / avgLoss;
-            result.push_back(100.0 - (100.0 / (1.0 + rs)));
+            out[i - period] = 100.0 - (100.0 / (1.0 + rs));
+        }
+    }
+}
+
+inline void ema(const double* prices, std::size_t n, std::size_t period, double* out) {
+    double sum = 0.0;
+    for (std::size_t i = 0; i < period; ++i) {
+        sum += prices[i];
+    }
+    double value = sum / static_cast<double>(period);
+    out[0]       = value;
+
+    const double alpha = 2.0 / (static_cast<double>(period) + 1.0);
+    for (std::size_t i = period; i < n; ++i) {
+        value += alpha * (prices[i] - value);
+        out[i - period + 1] = value;
+    }
+}
+
+inline void returns(const double* prices, std::size_t n, double* out) {
+    for (std::size_t i = 1; i < n; ++i) {
+        out[i - 1] = prices[i] / prices[i - 1] - 1.0;
+    }
+}
+
+inline void logReturns(const double* prices, std::size_t n, double* out) {
+    for (std::size_t i = 1; i < n; ++i) {
+        out[i - 1] = std::log(prices[i] / prices[i - 1]);
+    }
+}
+
+/**
+ * @brief Size `out` to the input (keeping its capacity) and NaN its first `warmUp` values.
+ */
+inline void alignedPrefix(std::size_t n, std::size_t warmUp, std::vector<double>& out) {
+    out.resize(n);
+    std::fill_n(out.begin(), std::min(warmUp, n), std::numeric_limits<double>::quiet_NaN());
+}
+
+}  // namespace detail
+
+/**
+ * @brief Compute Simple Moving Average (SMA).
+ * @param prices  Input price series.
+ * @param window  Window size for the moving average.
+ * @return        SMA values. Size = prices.size() - window + 1.
+ *                An empty vector is returned if prices.size() < window.
+ */
+[[nodiscard]] inline std::vector<double> sma(const std::vector<double>& prices, std::size_t window) {
+    if (window == 0 || prices.size() < window) {
+        return {};
+    }
+
+    std::vector<double> result(prices.size() - window + 1);
+    detail::sma(prices.data(), prices.size(), window, result.data());
+    return result;
+}
+
+/**
+ * @brief Compute Relative Strength Index (RSI).
+ * @param prices  Input price series.
+ * @param period  Lookback period (typically 14).
+ * @return        RSI values (0~100). Size = prices.size() - period.
+ *                An empty vector is returned if prices.size() <= period.
+ *
+ * Uses Wilder's smoothing method (exponential moving average of gains/losses).
+ */
+[[nodiscard]] inline std::vector<double> rsi(const std::vector<double>& prices, std::size_t period) {
+    if (period == 0 || prices.size() <= period) {
+        return {};
+    }
+
+    std::vector<double> result(prices.size() - period);
+    detail::rsi(prices.data(), prices.size(), period, result.data());
+    return result;
+}
+
+/**
+ * @brief SMA with a compile-time window: the seed sum is unrolled, the lagged load
+ *        uses a constant offset and the divisor is a constant. Same values as sma(prices, N).
+ */
+template <std::size_t N>
+[[nodiscard]] inline std::vector<double> sma(const std::vector<double>& prices) {
+    static_assert(N > 0, "SMA window must be positive");
+    if (prices.size() < N) {
+        return {};
+    }
+
+    constexpr double size = static_cast<double>(N);
+
+    std::vector<double> result(prices.size() - N + 1);
+
+    const double* p   = prices.data();
+    double        sum = 0.0;
+    for (std::size_t i = 0; i < N; ++i) {
+        sum += p[i];
+    }
+    result[0] = sum / size;
+
+    for (std::size_t i = N; i < prices.size(); ++i) {
+        sum += p[i] - p[i - N];
+        result[i - N + 1] = sum / size;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Wilder RSI with a compile-time period: the smoothing constants are folded.
+ *        Same values as rsi(prices, N).
+ */
+template <std::size_t N>
+[[nodiscard]] inline std::vector<double> rsi(const std::vector<double>& prices) {
+    static_assert(N > 0, "RSI period must be positive");
+    if (prices.size() <= N) {
+        return {};
+    }
+
+    constexpr double smooth = static_cast<double>(N - 1) / static_cast<double>(N);
+    constexpr double inv    = 1.0 / static_cast<double>(N);
+
+    std::vector<double> result(prices.size() - N);
+
+    const double* p       = prices.data();
+    double        avgGain = 0.0;
+    double        avgLoss = 0.0;
+    for (std::size_t i = 1; i <= N; ++i) {
+        const double change = p[i] - p[i - 1];
+        if (change > 0.0) {
+            avgGain += change;
+        } else {
+            avgLoss += -change;
+        }
+    }
+    avgGain /= static_cast<double>(N);
+    avgLoss /= static_cast<double>(N);
+    result[0] = avgLoss < 1e-12 ? 100.0 : 100.0 - (100.0 / (1.0 + avgGain / avgLoss));
+
+    for (std::size_t i = N + 1; i < prices.size(); ++i) {
+        const double change = p[i] - p[i - 1];
+        if (change > 0.0) {
+            avgGain = avgGain * smooth + change * inv;
+            avgLoss = avgLoss * smooth;
+        } else {
+            avgGain = avgGain * smooth;
+            avgLoss = avgLoss * smooth + (-change) * inv;
+        }
+        result[i - N] = avgLoss < 1e-12 ? 100.0 : 100.0 - (100.0 / (1.0 + avgGain / avgLoss));
+    }
+
+    return result;
+}
+
+/**
+ * @brief Compute Exponential Moving Average (EMA).
+ * @param prices  Input price series.
+ * @param period  Smoothing period; alpha = 2 / (period + 1).
+ * @return        EMA values, seeded with the SMA of the first `period` prices.
+ *                Size = prices.size() - period + 1.
+ *                An empty vector is returned if prices.size() < period.
+ */
+[[nodiscard]] inline std::vector<double> ema(const std::vector<double>& prices, std::size_t period) {
+    if (period == 0 || prices.size() < period) {
+        return {};
+    }
+
+    std::vector<double> result(prices.size() - period + 1);
+    detail::ema(prices.data(), prices.size(), period, result.data());
+    return result;
+}
+
+/* Aligned variants: write into caller storage, one value per input bar, so index i is
+   the indicator at bar i. The warm-up prefix (and all of `out` if the input is too
+   short) is NaN. `out` is resized to prices.size(); its capacity is reused across calls. */
+
+/**
+ * @brief SMA aligned to the input: out[i] = sma(...)[i - window + 1], NaN for i < window - 1.
+ */
+inline void smaInto(const std::vector<double>& prices, std::size_t window, std::vector<double>& out) {
+    const std::size_t n = prices.size();
+    if (window == 0 || n < window) {
+        detail::alignedPrefix(n, n, out);
+        return;
+    }
+    detail::alignedPrefix(n, window - 1, out);
+    detail::sma(prices.data(), n, window, out.data() + window - 1);
+}
+
+/**
+ * @brief RSI aligned to the input: out[i] = rsi(...)[i - period], NaN for i < period.
+ */
+inline void rsiInto(const std::vector<double>& prices, std::size_t period, std::vector<double>& out) {
+    const std::size_t n = prices.size();
+    if (period == 0 || n <= period) {
+        detail::alignedPrefix(n, n, out);
+        return;
+    }
+    detail::alignedPrefix(n, period, out);
+    detail::rsi(prices.data(), n, period, out.data() + period);
+}
+
+/**
+ * @brief EMA aligned to the input: out[i] = ema(...)[i - period + 1], NaN for i < period - 1.
+ */
+inline void emaInto(const std::vector<double>& prices, std::size_t period, std::vector<double>& out) {
+    const std::size_t n = prices.size();
+    if (period == 0 || n < period) {
+        detail::alignedPrefix(n, n, out);
+        return;
+    }
+    detail::alignedPrefix(n, period - 1, out);
+    detail::ema(prices.data(), n, period, out.data() + period - 1);
+}
+
+/**
+ * @brief Compute rolling population variance.
+ * @param prices  Input price series.
+ * @param window  Window size.
+ * @return        Variance of each window. Size = prices.size() - window + 1.
+ *                An empty vector is returned if prices.size() < window.
+ *
+ * Uses Welford's update (a sliding add/remove once the window is full), which
+ * avoids the cancellation of sum-of-squares formulas on price-sized values.
+ */
+[[nodiscard]] inline std::vector<double> variance(const std::vector<double>& prices, std::size_t window) {
+    if (window == 0 || prices.size() < window) {
+        return {};
+    }
+
+    std::vector<double> result;
+    result.reserve(prices.size() - window + 1);
+
+    const double n    = static_cast<double>(window);
+    double       mean = 0.0;
+    double       m2   = 0.0;
+    for (std::size_t i = 0; i < window; ++i) {
+        const double delta = prices[i] - mean;
+        mean += delta / static_cast<double>(i + 1);
+        m2 += delta * (prices[i] - mean);
+    }
+    result.push_back(m2 > 0.0 ? m2 / n : 0.0);
+
+    for (std::size_t i = window; i < prices.size(); ++i) {
+        const double added   = prices[i];
+        const double removed = prices[i - window];
+        const double oldMean = mean;
+        mean += (added - removed) / n;
+        m2 += (added - removed) * ((added - mean) + (removed - oldMean));
+        result.push_back(m2 > 0.0 ? m2 / n : 0.0);
+    }
+
+    return result;
+}
+
+namespace detail {
+
+[[nodiscard]] inline std::size_t wrap(std::size_t slot, std::size_t size) {
+    return slot >= size ? slot - size : slot;
+}
+
+/**
+ * @brief Rolling extremum with a monotonic deque of indices (held in a ring of
+ *        `window` slots): each index is pushed and popped at most once.
+ */
+template <typename Better>
+[[nodiscard]] inline std::vector<double> rollingExtremum(const std::vector<double>& values, std::size_t window) {
+    if (window == 0 || values.size() < window) {
+        return {};
+    }
+
+    std::vector<double> result;
+    result.reserve(values.size() - window + 1);
+
+    std::vector<std::size_t> ring(window);
+    std::size_t              head = 0;
+    std::size_t              size = 0;
+
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (size > 0 && ring[head] + window <= i) {
+            head = wrap(head + 1, window);
+            --size;
+        }
+        while (size > 0 && !Better{}(values[ring[wrap(head + size - 1, window)]], values[i])) {
+            --size;
+        }
+        ring[wrap(head + size, window)] = i;
+        ++size;
+
+        if (i + 1 >= window) {
+            result.push_back(values[ring[head]]);
         }
     }
 
     return result;
 }
 
+}  // namespace detail
+
+/**
+ * @brief Compute the rolling maximum in amortized O(1) per value.
+ * @param values  Input series.
+ * @param window  Window size.
+ * @return        Maximum of each window. Size = values.size() - window + 1.
+ *                An empty vector is returned if values.size() < window.
+ */
+[[nodiscard]] inline std::vector<double> rollingMax(const std::vector<double>& values, std::size_t window) {
+    return detail::rollingExtremum<std::greater<double>>(values, window);
+}
+
+/**
+ * @brief Compute the rolling minimum in amortized O(1) per value.
+ * @param values  Input series.
+ * @param window  Window size.
+ * @return        Minimum of each window. Size = values.size() - window + 1.
+ *                An empty vector is returned if values.size() < window.
+ */
+[[nodiscard]] inline std::vector<double> rollingMin(const std::vector<double>& values, std::size_t window) {
+    return detail::rollingExtremum<std::less<double>>(values, window);
+}
+
+/**
+ * @brief Compute simple returns.
+ * @param prices  Input price series.
+ * @return        prices[i] / prices[i - 1] - 1 for i >= 1. Size = prices.size() - 1.
+ *                An empty vector is returned if prices.size() < 2.
+ */
+[[nodiscard]] inline std::vector<double> returns(const std::vector<double>& prices) {
+    if (prices.size() < 2) {
+        return {};
+    }
+
+    std::vector<double> result(prices.size() - 1);
+    detail::returns(prices.data(), prices.size(), result.data());
+    return result;
+}
+
+/**
+ * @brief Compute log returns.
+ * @param prices  Input price series.
+ * @return        log(prices[i] / prices[i - 1]) for i >= 1. Size = prices.size() - 1.
+ *                An empty vector is returned if prices.size() < 2.
+ */
+[[nodiscard]] inline std::vector<double> logReturns(const std::vector<double>& prices) {
+    if (prices.size() < 2) {
+        return {};
+    }
+
+    std::vector<double> result(prices.size() - 1);
+    detail::logReturns(prices.data(), prices.size(), result.data());
+    return result;
+}
+
 }  // namespace indicator
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "indicator/gaps.hpp"
+
+/**
+ * @brief Indicator families: one indicator over many windows in a single pass.
+ *
+ * Parameter sweeps (e.g. SMA crossover over short/long grids) otherwise call
+ * indicator::sma() once per window and re-scan the prices each time. Here the
+ * prices are read once and every window is written into one matrix.
+ *
+ * The overloads taking an IndicatorMatrix& reuse its storage, so a sweep over
+ * many symbols allocates the matrix once.
+ *
+ * Missing bars (NaN) are handled by a GapPolicy, with the layouts of the
+ * gaps.hpp functions; a series without gaps runs the kernels directly.
+ */
+namespace indicator {
+
+/**
+ * @brief One row per window, each row aligned to the input bars: row(r)[i] is the
+ *        value at bar i, NaN while the window warms up (and for windows that never
+ *        fit the series). Rows are contiguous, so a crossover scan over a pair of
+ *        windows walks two rows side by side.
+ */
+struct IndicatorMatrix {
+    std::vector<std::size_t> windows;
+    std::size_t              bars = 0;
+    std::vector<double>      values;  // windows.size() rows of `bars` values, row-major
+
+    [[nodiscard]] std::size_t   rows() const { return windows.size(); }
+    [[nodiscard]] const double* row(std::size_t r) const { return values.data() + r * bars; }
+    [[nodiscard]] double*       row(std::size_t r) { return values.data() + r * bars; }
+
+    /**
+     * @return Row index of `window`, or rows() if it is not in the family.
+     */
+    [[nodiscard]] std::size_t rowOf(std::size_t window) const;
+};
+
+/**
+ * @return first, first + step, ... up to and including last.
+ */
+[[nodiscard]] std::vector<std::size_t> windowRange(std::size_t first, std::size_t last, std::size_t step = 1);
+
+/**
+ * @brief How smaFamily() computes its rows.
+ */
+enum class SmaFamilyMode
+{
+    Exact,   // a sliding sum per window, 8 windows updated together per bar: bit-identical to indicator::sma()
+    Prefix,  // each row streams (prefix[i + 1] - prefix[i + 1 - w]) / w over one compensated prefix sum:
+             // cheaper for wide grids and within an ulp of the exact mean, but not bit-identical to
+             // indicator::sma(), whose running sum drifts by more
+};
+
+/**
+ * @brief SMAs for every window over one read of the prices (see SmaFamilyMode).
+ */
+[[nodiscard]] IndicatorMatrix smaFamily(const std::vector<double>&      prices,
+                                        const std::vector<std::size_t>& windows,
+                                        SmaFamilyMode                   mode = SmaFamilyMode::Exact,
+                                        GapPolicy                       gaps = GapPolicy::Skip);
+void smaFamily(const std::vector<double>&      prices,
+               const std::vector<std::size_t>& windows,
+               IndicatorMatrix&                out,
+               SmaFamilyMode                   mode = SmaFamilyMode::Exact,
+               GapPolicy                       gaps = GapPolicy::Skip);
+
+/**
+ * @brief EMAs for every period in one pass over the prices, updating all periods
+ *        per bar. Bit-identical to indicator::ema() per row.
+ */
+[[nodiscard]] IndicatorMatrix emaFamily(const std::vector<double>&      prices,
+                                        const std::vector<std::size_t>& periods,
+                                        GapPolicy                       gaps = GapPolicy::Skip);
+void emaFamily(const std::vector<double>&      prices,
+               const std::vector<std::size_t>& periods,
+               IndicatorMatrix&                out,
+               GapPolicy                       gaps = GapPolicy::Skip);
+
+/**
+ * @brief Wilder RSIs for every period in one pass; the price changes are computed
+ *        once and shared. Bit-identical to indicator::rsi() per row (first value at
+ *        bar `period`).
+ */
+[[nodiscard]] IndicatorMatrix rsiFamily(const std::vector<double>&      prices,
+                                        const std::vector<std::size_t>& periods,
+                                        GapPolicy                       gaps = GapPolicy::Skip);
+void rsiFamily(const std::vector<double>&      prices,
+               const std::vector<std::size_t>& periods,
+               IndicatorMatrix&                out,
+               GapPolicy                       gaps = GapPolicy::Skip);
+
+}  // namespace indicator
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "indicator/gaps.hpp"
+
+namespace indicator {
+
+/**
+ * @brief Identity of an input series: its buffer address and length, plus a
+ *        caller-supplied version that changes whenever its data does.
+ *
+ * For StockInfo columns the version is StockInfo::version, which every writer
+ * of the columns renews, so a reused buffer holding new data (or an in-place
+ * edit followed by touch()) never hits an old entry. Other series need a
+ * version their owner renews the same way (e.g., StockInfo::nextVersion()).
+ */
+struct SeriesKey {
+    const void* identity = nullptr;
+    std::size_t size     = 0;
+    uint64_t    version  = 0;
+
+    [[nodiscard]] static SeriesKey of(const std::vector<double>& values, uint64_t version);
+
+    bool operator==(const SeriesKey& other) const {
+        return identity == other.identity && size == other.size && version == other.version;
+    }
+};
+
+enum class IndicatorKind : uint32_t
+{
+    Sma,
+    Ema,
+    Rsi,
+    Variance,
+    RollingMax,
+    RollingMin,
+    AlignedSma,
+    AlignedRsi,
+    Custom = 1024,  // first tag free for getOrCompute() callers
+};
+
+struct IndicatorKey {
+    SeriesKey     series;
+    IndicatorKind kind  = IndicatorKind::Sma;
+    uint64_t      param = 0;  // window / period, or any caller-defined encoding
+
+    bool operator==(const IndicatorKey& other) const {
+        return series == other.series && kind == other.kind && param == other.param;
+    }
+};
+
+struct IndicatorKeyHash {
+    std::size_t operator()(const IndicatorKey& key) const;
+};
+
+/**
+ * @brief Thread-safe memo of indicator results, evicting least recently used
+ *        entries once their total size exceeds a byte budget.
+ *
+ * Results are shared immutable vectors, so an evicted entry stays valid for
+ * the holders that already have it. Concurrent requests for the same key wait
+ * for one computation instead of repeating it; computations run outside the lock.
+ */
+class IndicatorCache {
+   public:
+    using Values = std::shared_ptr<const std::vector<double>>;
+
+    struct Stats {
+        std::size_t hits      = 0;
+        std::size_t misses    = 0;  // = number of computations
+        std::size_t evictions = 0;
+        std::size_t entries   = 0;
+        std::size_t bytes     = 0;
+    };
+
+    explicit IndicatorCache(std::size_t capacityBytes = std::size_t{64} << 20);
+
+    IndicatorCache(const IndicatorCache& other) = delete;
+    IndicatorCache& operator=(const IndicatorCache& other) = delete;
+
+    /* Same results (and sizes) as the indicator.hpp functions; `version` as in SeriesKey */
+
+    [[nodiscard]] Values sma(const std::vector<double>& prices, uint64_t version, std::size_t window);
+    [[nodiscard]] Values ema(const std::vector<double>& prices, uint64_t version, std::size_t period);
+    [[nodiscard]] Values rsi(const std::vector<double>& prices, uint64_t version, std::size_t period);
+    [[nodiscard]] Values variance(const std::vector<double>& prices, uint64_t version, std::size_t window);
+    [[nodiscard]] Values rollingMax(const std::vector<double>& values, uint64_t version, std::size_t window);
+    [[nodiscard]] Values rollingMin(const std::vector<double>& values, uint64_t version, std::size_t window);
+
+    /* Same results as the GapPolicy smaInto() / rsiInto() of gaps.hpp: one value per input bar */
+
+    [[nodiscard]] Values alignedSma(const std::vector<double>& prices,
+                                    uint64_t                   version,
+                                    std::size_t                window,
+                                    GapPolicy                  gaps = GapPolicy::Skip);
+    [[nodiscard]] Values alignedRsi(const std::vector<double>& prices,
+                                    uint64_t                   version,
+                                    std::size_t                period,
+                                    GapPolicy                  gaps = GapPolicy::Skip);
+
+    /**
+     * @brief Cached value of `key`, calling `compute` on a miss. If `compute`
+     *        throws, nothing is cached and the exception reaches every waiter.
+     */
+    [[nodiscard]] Values getOrCompute(const IndicatorKey& key, const std::function<std::vector<double>()>& compute);
+
+    /**
+     * @brief Drop every entry computed from `values` (any version), to free their memory early.
+     */
+    void invalidate(const std::vector<double>& values);
+
+    void clear();
+
+    [[nodiscard]] Stats stats() const;
+
+    [[nodiscard]] std::size_t capacity() const { return capacityBytes_; }
+
+   private:
+    struct Entry {
+        std::shared_future<Values>        value;
+        std::size_t                       bytes  = 0;  // 0 while the computation is in flight
+        uint64_t                          ticket = 0;  // tells a re-inserted key from the one being computed
+        std::list<IndicatorKey>::iterator lru;
+    };
+
+    void evict();  // caller holds mutex_
+
+    std::size_t capacityBytes_;
+
+    mutable std::mutex                                        mutex_;
+    std::unordered_map<IndicatorKey, Entry, IndicatorKeyHash> entries_;
+    std::list<IndicatorKey>                                   lru_;  // most recently used first
+    std::size_t                                               bytes_      = 0;
+    uint64_t                                                  nextTicket_ = 0;
+    std::size_t                                               hits_       = 0;
+    std::size_t                                               misses_     = 0;
+    std::size_t                                               evictions_  = 0;
+};
+
+}  // namespace indicator
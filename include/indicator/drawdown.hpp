@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Drawdown kernels over an equity (or price) curve, all O(n).
+ *
+ * Drawdowns are in percent of the reference peak and never positive:
+ * (value - peak) / peak * 100.
+ */
+namespace indicator {
+
+struct DrawdownStats {
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    double      maxDrawdownPct    = 0.0;   // deepest decline from the running peak
+    std::size_t peak              = 0;     // bar where that running peak was set
+    std::size_t trough            = 0;     // bar of the deepest decline
+    std::size_t recovery          = npos;  // first bar after the trough back at the peak, npos if never
+    std::size_t longestUnderwater = 0;     // most consecutive bars below the running peak
+
+    [[nodiscard]] std::size_t declineBars() const { return trough - peak; }
+
+    /**
+     * @return Bars from the trough back to the peak, or npos if not recovered.
+     */
+    [[nodiscard]] std::size_t recoveryBars() const { return recovery == npos ? npos : recovery - trough; }
+};
+
+/**
+ * @brief Underwater curve: drawdown from the running peak and the bars spent below it.
+ */
+struct Underwater {
+    std::vector<double>      depthPct;  // (value - running peak) / running peak * 100
+    std::vector<std::size_t> duration;  // bars since the running peak was last reached (0 at a peak)
+};
+
+/**
+ * @brief Maximum drawdown from the running peak, in percent (0 for an empty curve).
+ */
+[[nodiscard]] double maxDrawdownPct(const std::vector<double>& equity);
+
+/**
+ * @brief Maximum drawdown with its peak, trough, recovery and longest underwater stretch.
+ */
+[[nodiscard]] DrawdownStats drawdownStats(const std::vector<double>& equity);
+
+[[nodiscard]] Underwater underwater(const std::vector<double>& equity);
+
+/**
+ * @brief Drawdown of each bar from the peak of its trailing window, via the rolling maximum.
+ * @return Size = equity.size() - window + 1; empty if equity.size() < window.
+ */
+[[nodiscard]] std::vector<double> rollingDrawdown(const std::vector<double>& equity, std::size_t window);
+
+}  // namespace indicator
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "stock_info.hpp"
+
+/**
+ * @brief Lazy indicator expressions.
+ *
+ * Building an Expr only records a node, e.g.
+ *
+ *     auto spread = expr::close().sma(20) - expr::close().sma(50);
+ *
+ * and evaluate() runs the whole graph in one pass over the bars, a block at a
+ * time: every node computes its block from its inputs' blocks, which stay in
+ * cache, so the StockInfo columns are read once and only the requested outputs
+ * are written to memory. Structurally identical subexpressions are evaluated
+ * once, also across the outputs of one evaluate() call.
+ *
+ * Outputs are aligned to the input bars. Windowed nodes (sma, ema, rsi, ...)
+ * skip NaN inputs, so an indicator of an indicator starts once its input has
+ * warmed up: close().rsi(14).sma(5) is the 5-bar SMA of the RSI, first valid at
+ * bar 18. Element-wise nodes propagate NaN. Windowed nodes match the
+ * indicator.hpp functions bit for bit.
+ */
+namespace indicator::expr {
+
+struct Node;
+
+class Expr {
+   public:
+    [[nodiscard]] Expr sma(std::size_t window) const;
+    [[nodiscard]] Expr ema(std::size_t period) const;
+    [[nodiscard]] Expr rsi(std::size_t period) const;
+    [[nodiscard]] Expr stddev(std::size_t window) const;  // rolling population standard deviation
+    [[nodiscard]] Expr rollingMax(std::size_t window) const;
+    [[nodiscard]] Expr rollingMin(std::size_t window) const;
+    [[nodiscard]] Expr lag(std::size_t bars) const;  // value `bars` bars earlier
+    [[nodiscard]] Expr abs() const;
+    [[nodiscard]] Expr log() const;
+
+    friend Expr operator+(const Expr& lhs, const Expr& rhs);
+    friend Expr operator-(const Expr& lhs, const Expr& rhs);
+    friend Expr operator*(const Expr& lhs, const Expr& rhs);
+    friend Expr operator/(const Expr& lhs, const Expr& rhs);
+    friend Expr operator-(const Expr& operand);
+
+    /**
+     * @brief 1.0 where the comparison holds, 0.0 where it does not, NaN if either side is NaN.
+     */
+    friend Expr operator>(const Expr& lhs, const Expr& rhs);
+    friend Expr operator<(const Expr& lhs, const Expr& rhs);
+
+    friend Expr min(const Expr& lhs, const Expr& rhs);
+    friend Expr max(const Expr& lhs, const Expr& rhs);
+
+    [[nodiscard]] const std::shared_ptr<const Node>& node() const { return node_; }
+
+   private:
+    friend Expr makeExpr(std::shared_ptr<const Node> node);
+
+    explicit Expr(std::shared_ptr<const Node> node) : node_(std::move(node)) {}
+
+    std::shared_ptr<const Node> node_;
+};
+
+[[nodiscard]] Expr open();
+[[nodiscard]] Expr high();
+[[nodiscard]] Expr low();
+[[nodiscard]] Expr close();
+[[nodiscard]] Expr volume();
+[[nodiscard]] Expr constant(double value);
+
+Expr operator+(const Expr& lhs, double rhs);
+Expr operator+(double lhs, const Expr& rhs);
+Expr operator-(const Expr& lhs, double rhs);
+Expr operator-(double lhs, const Expr& rhs);
+Expr operator*(const Expr& lhs, double rhs);
+Expr operator*(double lhs, const Expr& rhs);
+Expr operator/(const Expr& lhs, double rhs);
+Expr operator/(double lhs, const Expr& rhs);
+
+/**
+ * @brief Evaluate one expression over `data`.
+ * @return One value per bar; empty if the columns it reads differ in length from close.
+ */
+[[nodiscard]] std::vector<double> evaluate(const Expr& expr, const StockInfo& data);
+
+/**
+ * @brief Evaluate several expressions in one pass, sharing their common subexpressions.
+ */
+[[nodiscard]] std::vector<std::vector<double>> evaluate(const std::vector<Expr>& exprs, const StockInfo& data);
+
+/**
+ * @brief Number of nodes evaluate() would run for `exprs` after merging common subexpressions.
+ */
+[[nodiscard]] std::size_t distinctNodes(const std::vector<Expr>& exprs);
+
+}  // namespace indicator::expr
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "stock_info.hpp"
+
+/**
+ * @brief Fused indicator kernels over StockInfo columns.
+ *
+ * Related outputs share their state and are produced in one pass: Bollinger
+ * bands, rolling standard deviation and z-score come from one Welford rolling
+ * variance, the Donchian channel from two monotonic-deque extrema, and MACD line,
+ * signal and histogram from three chained EMAs. computeFeatures() runs every
+ * kernel in a single pass over close/high/low/volume.
+ *
+ * Unlike indicator.hpp, every output is aligned to the input bars: element i is
+ * the value at bar i, NaN while the indicator warms up. Missing bars (NaN, see
+ * gaps.hpp) are skipped as with GapPolicy::Skip: the kernels carry their state
+ * over the gap and write NaN at the missing bars.
+ */
+namespace indicator {
+
+struct Macd {
+    std::vector<double> line;       // fast EMA - slow EMA
+    std::vector<double> signal;     // EMA of the line
+    std::vector<double> histogram;  // line - signal
+};
+
+struct BollingerBands {
+    std::vector<double> middle;  // rolling mean
+    std::vector<double> upper;   // middle + width * stddev
+    std::vector<double> lower;   // middle - width * stddev
+    std::vector<double> stddev;  // rolling population standard deviation
+    std::vector<double> zscore;  // (close - middle) / stddev, 0 for a flat window
+};
+
+struct DonchianChannel {
+    std::vector<double> upper;   // highest high of the window
+    std::vector<double> lower;   // lowest low of the window
+    std::vector<double> middle;  // (upper + lower) / 2
+};
+
+struct FeatureConfig {
+    std::size_t smaWindow       = 50;
+    std::size_t emaPeriod       = 20;
+    std::size_t rsiPeriod       = 14;
+    std::size_t macdFast        = 12;
+    std::size_t macdSlow        = 26;
+    std::size_t macdSignal      = 9;
+    std::size_t bollingerWindow = 20;  // also the stddev / z-score window
+    double      bollingerWidth  = 2.0;
+    std::size_t atrPeriod       = 14;
+    std::size_t donchianWindow  = 20;
+};
+
+/**
+ * @brief Every feature of a FeatureConfig, aligned to the input bars.
+ */
+struct Features {
+    std::vector<double> sma;
+    std::vector<double> ema;
+    std::vector<double> rsi;
+    Macd                macd;
+    BollingerBands      bollinger;
+    std::vector<double> atr;
+    DonchianChannel     donchian;
+    std::vector<double> obv;
+};
+
+/**
+ * @brief MACD line, signal and histogram in one pass over the prices.
+ *        Values start at bar max(fast, slow) - 1; the signal `signal - 1` bars later.
+ */
+[[nodiscard]] Macd macd(const std::vector<double>& prices,
+                        std::size_t                fast   = 12,
+                        std::size_t                slow   = 26,
+                        std::size_t                signal = 9);
+
+/**
+ * @brief Bollinger bands with their rolling stddev and z-score, from one rolling variance.
+ */
+[[nodiscard]] BollingerBands bollinger(const std::vector<double>& prices, std::size_t window = 20, double width = 2.0);
+
+/**
+ * @brief Rolling population standard deviation (the stddev column of bollinger()).
+ */
+[[nodiscard]] std::vector<double> stddev(const std::vector<double>& prices, std::size_t window);
+
+/**
+ * @brief Rolling z-score of each price against its window (the zscore column of bollinger()).
+ */
+[[nodiscard]] std::vector<double> zscore(const std::vector<double>& prices, std::size_t window);
+
+/**
+ * @brief Wilder Average True Range. The first bar's true range is high - low;
+ *        the ATR is seeded with the mean of the first `period` true ranges.
+ */
+[[nodiscard]] std::vector<double> atr(const StockInfo& data, std::size_t period = 14);
+
+/**
+ * @brief Donchian channel over the highs and lows.
+ */
+[[nodiscard]] DonchianChannel donchian(const StockInfo& data, std::size_t window = 20);
+
+/**
+ * @brief On-balance volume, starting at 0 on the first bar.
+ */
+[[nodiscard]] std::vector<double> obv(const StockInfo& data);
+
+/**
+ * @brief All features of `config` in one pass over the close, high, low and volume columns.
+ * @return Empty columns if the columns differ in length.
+ */
+[[nodiscard]] Features computeFeatures(const StockInfo& data, const FeatureConfig& config = {});
+
+}  // namespace indicator
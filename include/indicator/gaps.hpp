@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Indicators over series with missing bars.
+ *
+ * Missing bars are NaN (yFinance decodes Yahoo's null bars that way). Each
+ * function returns one value per input bar, NaN where the indicator is not
+ * defined, and handles the gaps according to a GapPolicy. The kernels are the
+ * scalar indicator.hpp ones, run directly on a series without gaps and on the
+ * valid stretches otherwise (so no cleaned copy of the input is needed for
+ * Propagate). Results are therefore the same on every CPU, and equal to the
+ * indicator.hpp functions over the compacted (Skip), filled (ForwardFill) or
+ * per-stretch (Propagate) series. simd.hpp is the explicit opt-in to the
+ * vectorized kernels.
+ */
+namespace indicator {
+
+enum class GapPolicy
+{
+    Skip,         // drop missing bars: windows span the last `window` valid bars; NaN at the missing ones
+    ForwardFill,  // repeat the last valid value through a gap (leading missing bars stay NaN)
+    Propagate,    // a missing bar poisons every window containing it; the indicator restarts after the gap
+};
+
+/**
+ * @return Number of NaN values in `values`.
+ */
+[[nodiscard]] std::size_t gapCount(const std::vector<double>& values);
+
+/**
+ * @brief Copy of `values` with gaps forward-filled (leading gaps stay NaN), for callers
+ *        that want the cleaned series itself.
+ */
+[[nodiscard]] std::vector<double> forwardFill(const std::vector<double>& values);
+
+/* Gap-aware variants of the indicator.hpp functions, aligned to the input bars */
+
+[[nodiscard]] std::vector<double> sma(const std::vector<double>& prices, std::size_t window, GapPolicy policy);
+[[nodiscard]] std::vector<double> ema(const std::vector<double>& prices, std::size_t period, GapPolicy policy);
+[[nodiscard]] std::vector<double> rsi(const std::vector<double>& prices, std::size_t period, GapPolicy policy);
+[[nodiscard]] std::vector<double> variance(const std::vector<double>& prices, std::size_t window, GapPolicy policy);
+[[nodiscard]] std::vector<double> rollingMax(const std::vector<double>& values, std::size_t window, GapPolicy policy);
+[[nodiscard]] std::vector<double> rollingMin(const std::vector<double>& values, std::size_t window, GapPolicy policy);
+
+/**
+ * @brief Policy variants of the indicator.hpp *Into() functions: without gaps they
+ *        are those functions (bit for bit, reusing `out`), with gaps the functions above.
+ */
+void smaInto(const std::vector<double>& prices, std::size_t window, GapPolicy policy, std::vector<double>& out);
+void rsiInto(const std::vector<double>& prices, std::size_t period, GapPolicy policy, std::vector<double>& out);
+void emaInto(const std::vector<double>& prices, std::size_t period, GapPolicy policy, std::vector<double>& out);
+
+/**
+ * @brief With Skip, the return at a bar after a gap is taken against the last valid bar.
+ */
+[[nodiscard]] std::vector<double> returns(const std::vector<double>& prices, GapPolicy policy);
+[[nodiscard]] std::vector<double> logReturns(const std::vector<double>& prices, GapPolicy policy);
+
+}  // namespace indicator
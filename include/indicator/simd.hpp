@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Vectorized indicator kernels with runtime CPU dispatch.
+ *
+ * Each kernel is built for SSE2, AVX2 and AVX-512 in separate translation
+ * units; the widest one the CPU supports is picked on first use. Results match
+ * the scalar functions of indicator.hpp within floating-point tolerance (the
+ * running sums are re-associated across lanes), except returns(), which is
+ * bit-identical. With Isa::Scalar they are bit-identical to indicator.hpp.
+ */
+namespace indicator::simd {
+
+enum class Isa
+{
+    Scalar,
+    Sse2,
+    Avx2,
+    Avx512,
+};
+
+/**
+ * @brief Widest instruction set this CPU and build support (detected once).
+ */
+[[nodiscard]] Isa detectedIsa();
+
+/**
+ * @brief Instruction set the kernels currently dispatch to.
+ */
+[[nodiscard]] Isa activeIsa();
+
+/**
+ * @brief Override the dispatch target, e.g. to compare paths in benchmarks.
+ * @return The ISA now active: `isa`, clamped to detectedIsa().
+ */
+Isa setIsa(Isa isa);
+
+[[nodiscard]] const char* isaName(Isa isa);
+
+/**
+ * @brief SMA as a prefix sum of the window differences p[i] - p[i - window],
+ *        scanned a register at a time. Same contract as indicator::sma().
+ */
+[[nodiscard]] std::vector<double> sma(const std::vector<double>& prices, std::size_t window);
+
+/**
+ * @brief Wilder RSI with branchless gain/loss splitting; the smoothing recurrence is
+ *        solved a register at a time. Same contract as indicator::rsi().
+ */
+[[nodiscard]] std::vector<double> rsi(const std::vector<double>& prices, std::size_t period);
+
+/**
+ * @brief Simple returns p[i] / p[i - 1] - 1. Same contract as indicator::returns().
+ */
+[[nodiscard]] std::vector<double> returns(const std::vector<double>& prices);
+
+/**
+ * @brief Log returns log(p[i] / p[i - 1]) with a vectorized log (within 2 ulp of std::log).
+ *        Same contract as indicator::logReturns().
+ */
+[[nodiscard]] std::vector<double> logReturns(const std::vector<double>& prices);
+
+/* Pointer forms writing into caller storage. Nothing is written if the input is too short. */
+
+/**
+ * @param out Room for n - window + 1 values.
+ */
+void sma(const double* prices, std::size_t n, std::size_t window, double* out);
+
+/**
+ * @param out Room for n - period values.
+ */
+void rsi(const double* prices, std::size_t n, std::size_t period, double* out);
+
+/**
+ * @param out Room for n - 1 values.
+ */
+void returns(const double* prices, std::size_t n, double* out);
+
+/**
+ * @param out Room for n - 1 values.
+ */
+void logReturns(const double* prices, std::size_t n, double* out);
+
+}  // namespace indicator::simd
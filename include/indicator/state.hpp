@@ -0,0 +1,482 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <vector>
+
+/**
+ * @brief Incremental (streaming) counterparts of the indicator.hpp functions.
+ *
+ * Each state consumes one price per update() in O(1) and performs the same
+ * floating-point operations in the same order as the batch function, so after
+ * warmUp(history) + update(next) its value() equals the last element of the
+ * batch result over history + next, bit for bit.
+ *
+ * States are plain values: snapshot() is a copy and restore() an assignment.
+ * RsiState, EmaState and the Fixed* states (compile-time windows) hold no heap
+ * memory and are trivially copyable, so thousands of them can be checkpointed
+ * with one memcpy.
+ */
+namespace indicator {
+
+/**
+ * @brief Streaming Simple Moving Average (matches indicator::sma).
+ */
+class SmaState {
+   public:
+    explicit SmaState(std::size_t window = 20) : window_(window == 0 ? 1 : window), ring_(window_, 0.0) {}
+
+    void update(double price) {
+        if (count_ < window_) {
+            sum_ += price;
+            ++count_;
+        } else {
+            sum_ += price - ring_[pos_];
+        }
+        ring_[pos_] = price;
+        pos_        = pos_ + 1 == window_ ? 0 : pos_ + 1;
+    }
+
+    /**
+     * @brief Feed a history in order (same as calling update() on each price).
+     */
+    void warmUp(const double* prices, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            update(prices[i]);
+        }
+    }
+    void warmUp(const std::vector<double>& prices) { warmUp(prices.data(), prices.size()); }
+
+    [[nodiscard]] bool ready() const { return count_ == window_; }
+
+    /**
+     * @return NaN until `window` prices have been seen.
+     */
+    [[nodiscard]] double value() const {
+        return ready() ? sum_ / static_cast<double>(window_) : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    [[nodiscard]] std::size_t window() const { return window_; }
+
+    void reset() {
+        sum_   = 0.0;
+        count_ = 0;
+        pos_   = 0;
+    }
+
+    [[nodiscard]] SmaState snapshot() const { return *this; }
+    void                   restore(const SmaState& snapshot) { *this = snapshot; }
+
+   private:
+    std::size_t         window_;
+    std::vector<double> ring_;  // last `window` prices; ring_[pos_] is the oldest once full
+    std::size_t         pos_   = 0;
+    std::size_t         count_ = 0;
+    double              sum_   = 0.0;
+};
+
+/**
+ * @brief SmaState with a compile-time window: the ring lives inline (no heap), so
+ *        the state is trivially copyable, and the divisor is a constant.
+ */
+template <std::size_t N>
+class FixedSmaState {
+    static_assert(N > 0, "SMA window must be positive");
+
+   public:
+    void update(double price) {
+        if (count_ < N) {
+            sum_ += price;
+            ++count_;
+        } else {
+            sum_ += price - ring_[pos_];
+        }
+        ring_[pos_] = price;
+        pos_        = pos_ + 1 == N ? 0 : pos_ + 1;
+    }
+
+    void warmUp(const double* prices, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            update(prices[i]);
+        }
+    }
+    void warmUp(const std::vector<double>& prices) { warmUp(prices.data(), prices.size()); }
+
+    [[nodiscard]] bool ready() const { return count_ == N; }
+
+    [[nodiscard]] double value() const {
+        return ready() ? sum_ / static_cast<double>(N) : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    [[nodiscard]] static constexpr std::size_t window() { return N; }
+
+    void reset() { *this = FixedSmaState(); }
+
+    [[nodiscard]] FixedSmaState snapshot() const { return *this; }
+    void                        restore(const FixedSmaState& snapshot) { *this = snapshot; }
+
+   private:
+    std::array<double, N> ring_{};
+    std::size_t           pos_   = 0;
+    std::size_t           count_ = 0;
+    double                sum_   = 0.0;
+};
+
+/**
+ * @brief Streaming Wilder RSI (matches indicator::rsi).
+ */
+class RsiState {
+   public:
+    explicit RsiState(std::size_t period = 14)
+        : period_(period == 0 ? 1 : period)
+        , smooth_(static_cast<double>(period_ - 1) / static_cast<double>(period_))
+        , inv_(1.0 / static_cast<double>(period_)) {}
+
+    void update(double price) {
+        if (count_ == 0) {
+            prev_  = price;
+            count_ = 1;
+            return;
+        }
+
+        const double change = price - prev_;
+        prev_               = price;
+
+        if (count_ <= period_) {
+            // Seed: plain sums of the first `period` changes, then their mean
+            if (change > 0.0) {
+                avgGain_ += change;
+            } else {
+                avgLoss_ += -change;
+            }
+            if (++count_ > period_) {
+                avgGain_ /= static_cast<double>(period_);
+                avgLoss_ /= static_cast<double>(period_);
+            }
+            return;
+        }
+
+        if (change > 0.0) {
+            avgGain_ = avgGain_ * smooth_ + change * inv_;
+            avgLoss_ = avgLoss_ * smooth_;
+        } else {
+            avgGain_ = avgGain_ * smooth_;
+            avgLoss_ = avgLoss_ * smooth_ + (-change) * inv_;
+        }
+    }
+
+    void warmUp(const double* prices, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            update(prices[i]);
+        }
+    }
+    void warmUp(const std::vector<double>& prices) { warmUp(prices.data(), prices.size()); }
+
+    [[nodiscard]] bool ready() const { return count_ > period_; }
+
+    /**
+     * @return RSI (0~100), or NaN until period + 1 prices have been seen.
+     */
+    [[nodiscard]] double value() const {
+        if (!ready()) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        if (avgLoss_ < 1e-12) {
+            return 100.0;
+        }
+        const double rs = avgGain_ / avgLoss_;
+        return 100.0 - (100.0 / (1.0 + rs));
+    }
+
+    [[nodiscard]] std::size_t period() const { return period_; }
+    [[nodiscard]] double      averageGain() const { return avgGain_; }
+    [[nodiscard]] double      averageLoss() const { return avgLoss_; }
+
+    void reset() { *this = RsiState(period_); }
+
+    [[nodiscard]] RsiState snapshot() const { return *this; }
+    void                   restore(const RsiState& snapshot) { *this = snapshot; }
+
+   private:
+    std::size_t period_;
+    double      smooth_;
+    double      inv_;
+    std::size_t count_   = 0;  // prices seen, saturating at period + 1
+    double      prev_    = 0.0;
+    double      avgGain_ = 0.0;
+    double      avgLoss_ = 0.0;
+};
+
+/**
+ * @brief RsiState with a compile-time period: the smoothing constants are folded.
+ */
+template <std::size_t N>
+class FixedRsiState {
+    static_assert(N > 0, "RSI period must be positive");
+
+    static constexpr double kSmooth = static_cast<double>(N - 1) / static_cast<double>(N);
+    static constexpr double kInv    = 1.0 / static_cast<double>(N);
+
+   public:
+    void update(double price) {
+        if (count_ == 0) {
+            prev_  = price;
+            count_ = 1;
+            return;
+        }
+
+        const double change = price - prev_;
+        prev_               = price;
+
+        if (count_ <= N) {
+            if (change > 0.0) {
+                avgGain_ += change;
+            } else {
+                avgLoss_ += -change;
+            }
+            if (++count_ > N) {
+                avgGain_ /= static_cast<double>(N);
+                avgLoss_ /= static_cast<double>(N);
+            }
+            return;
+        }
+
+        if (change > 0.0) {
+            avgGain_ = avgGain_ * kSmooth + change * kInv;
+            avgLoss_ = avgLoss_ * kSmooth;
+        } else {
+            avgGain_ = avgGain_ * kSmooth;
+            avgLoss_ = avgLoss_ * kSmooth + (-change) * kInv;
+        }
+    }
+
+    void warmUp(const double* prices, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            update(prices[i]);
+        }
+    }
+    void warmUp(const std::vector<double>& prices) { warmUp(prices.data(), prices.size()); }
+
+    [[nodiscard]] bool ready() const { return count_ > N; }
+
+    [[nodiscard]] double value() const {
+        if (!ready()) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        return avgLoss_ < 1e-12 ? 100.0 : 100.0 - (100.0 / (1.0 + avgGain_ / avgLoss_));
+    }
+
+    [[nodiscard]] static constexpr std::size_t period() { return N; }
+
+    void reset() { *this = FixedRsiState(); }
+
+    [[nodiscard]] FixedRsiState snapshot() const { return *this; }
+    void                        restore(const FixedRsiState& snapshot) { *this = snapshot; }
+
+   private:
+    std::size_t count_   = 0;
+    double      prev_    = 0.0;
+    double      avgGain_ = 0.0;
+    double      avgLoss_ = 0.0;
+};
+
+/**
+ * @brief Streaming Exponential Moving Average (matches indicator::ema).
+ */
+class EmaState {
+   public:
+    explicit EmaState(std::size_t period = 20)
+        : period_(period == 0 ? 1 : period), alpha_(2.0 / (static_cast<double>(period_) + 1.0)) {}
+
+    void update(double price) {
+        if (count_ < period_) {
+            // Seed with the SMA of the first `period` prices
+            value_ += price;
+            if (++count_ == period_) {
+                value_ /= static_cast<double>(period_);
+            }
+            return;
+        }
+        value_ += alpha_ * (price - value_);
+    }
+
+    void warmUp(const double* prices, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            update(prices[i]);
+        }
+    }
+    void warmUp(const std::vector<double>& prices) { warmUp(prices.data(), prices.size()); }
+
+    [[nodiscard]] bool ready() const { return count_ == period_; }
+
+    /**
+     * @return NaN until `period` prices have been seen.
+     */
+    [[nodiscard]] double value() const { return ready() ? value_ : std::numeric_limits<double>::quiet_NaN(); }
+
+    [[nodiscard]] std::size_t period() const { return period_; }
+    [[nodiscard]] double      alpha() const { return alpha_; }
+
+    void reset() { *this = EmaState(period_); }
+
+    [[nodiscard]] EmaState snapshot() const { return *this; }
+    void                   restore(const EmaState& snapshot) { *this = snapshot; }
+
+   private:
+    std::size_t period_;
+    double      alpha_;
+    std::size_t count_ = 0;
+    double      value_ = 0.0;  // running sum while seeding, then the EMA
+};
+
+/**
+ * @brief Streaming rolling population variance (matches indicator::variance).
+ *        Welford's update while filling, then a sliding add/remove.
+ */
+class VarianceState {
+   public:
+    explicit VarianceState(std::size_t window = 20) : window_(window == 0 ? 1 : window), ring_(window_, 0.0) {}
+
+    void update(double price) {
+        if (count_ < window_) {
+            ++count_;
+            const double delta = price - mean_;
+            mean_ += delta / static_cast<double>(count_);
+            m2_ += delta * (price - mean_);
+        } else {
+            const double n       = static_cast<double>(window_);
+            const double removed = ring_[pos_];
+            const double oldMean = mean_;
+            mean_ += (price - removed) / n;
+            m2_ += (price - removed) * ((price - mean_) + (removed - oldMean));
+        }
+        ring_[pos_] = price;
+        pos_        = pos_ + 1 == window_ ? 0 : pos_ + 1;
+    }
+
+    void warmUp(const double* prices, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            update(prices[i]);
+        }
+    }
+    void warmUp(const std::vector<double>& prices) { warmUp(prices.data(), prices.size()); }
+
+    [[nodiscard]] bool ready() const { return count_ == window_; }
+
+    /**
+     * @return Population variance of the window, or NaN until it is full.
+     */
+    [[nodiscard]] double value() const {
+        if (!ready()) {
+            return std::numeric_limits<double>::quiet_NaN();
+        }
+        return m2_ > 0.0 ? m2_ / static_cast<double>(window_) : 0.0;
+    }
+
+    /**
+     * @return Mean of the prices seen so far (of the window once full).
+     */
+    [[nodiscard]] double mean() const { return mean_; }
+
+    [[nodiscard]] std::size_t window() const { return window_; }
+
+    void reset() {
+        mean_  = 0.0;
+        m2_    = 0.0;
+        count_ = 0;
+        pos_   = 0;
+    }
+
+    [[nodiscard]] VarianceState snapshot() const { return *this; }
+    void                        restore(const VarianceState& snapshot) { *this = snapshot; }
+
+   private:
+    std::size_t         window_;
+    std::vector<double> ring_;
+    std::size_t         pos_   = 0;
+    std::size_t         count_ = 0;
+    double              mean_  = 0.0;
+    double              m2_    = 0.0;
+};
+
+/**
+ * @brief Streaming rolling extremum over the last `window` prices (matches
+ *        indicator::rollingMax / rollingMin): a monotonic deque (held in a ring)
+ *        of candidates, so each update is amortized O(1).
+ * @tparam Better Strict ordering; a candidate is dropped once a newer price is
+ *                at least as good. std::greater gives the max, std::less the min.
+ */
+template <typename Better>
+class RollingExtremumState {
+   public:
+    explicit RollingExtremumState(std::size_t window = 20)
+        : window_(window == 0 ? 1 : window), index_(window_), value_(window_) {}
+
+    void update(double price) {
+        // Drop the candidate leaving the window, then those the new price makes obsolete
+        if (size_ > 0 && index_[head_] + window_ <= seen_) {
+            head_ = head_ + 1 == window_ ? 0 : head_ + 1;
+            --size_;
+        }
+        while (size_ > 0 && !Better{}(value_[slot(size_ - 1)], price)) {
+            --size_;
+        }
+        const std::size_t back = slot(size_);
+        index_[back]           = seen_;
+        value_[back]           = price;
+        ++size_;
+        ++seen_;
+    }
+
+    void warmUp(const double* prices, std::size_t n) {
+        for (std::size_t i = 0; i < n; ++i) {
+            update(prices[i]);
+        }
+    }
+    void warmUp(const std::vector<double>& prices) { warmUp(prices.data(), prices.size()); }
+
+    [[nodiscard]] bool ready() const { return seen_ >= window_; }
+
+    /**
+     * @return Extremum of the last `window` prices, or NaN until the window is full.
+     */
+    [[nodiscard]] double value() const { return ready() ? value_[head_] : std::numeric_limits<double>::quiet_NaN(); }
+
+    /**
+     * @return Extremum of the prices seen so far once fewer than `window` (NaN if none).
+     */
+    [[nodiscard]] double partial() const {
+        return size_ > 0 ? value_[head_] : std::numeric_limits<double>::quiet_NaN();
+    }
+
+    [[nodiscard]] std::size_t window() const { return window_; }
+
+    void reset() {
+        head_ = 0;
+        size_ = 0;
+        seen_ = 0;
+    }
+
+    [[nodiscard]] RollingExtremumState snapshot() const { return *this; }
+    void                               restore(const RollingExtremumState& snapshot) { *this = snapshot; }
+
+   private:
+    [[nodiscard]] std::size_t slot(std::size_t offset) const {
+        const std::size_t s = head_ + offset;
+        return s >= window_ ? s - window_ : s;
+    }
+
+    std::size_t              window_;
+    std::vector<std::size_t> index_;  // update number of each candidate
+    std::vector<double>      value_;  // candidates, head_ first, strictly ordered by Better
+    std::size_t              head_ = 0;
+    std::size_t              size_ = 0;
+    std::size_t              seen_ = 0;
+};
+
+using RollingMaxState = RollingExtremumState<std::greater<double>>;
+using RollingMinState = RollingExtremumState<std::less<double>>;
+
+}  // namespace indicator
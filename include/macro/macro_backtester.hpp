@@ -34,6 +34,12 @@ struct MacroBacktestResult {
     std::vector<MacroBacktestPeriod> periods;
 };
 
+/**
+ * @brief Monthly asset returns indexed by the SymbolTable::global() ID of their
+ *        asset-class key ("stocks", "gold", "metals", "bonds", "cash").
+ */
+using AssetReturnTable = std::vector<std::vector<double>>;
+
 class MacroBacktester {
    public:
     /**
@@ -52,6 +58,20 @@ class MacroBacktester {
                                    const std::vector<std::string>& dates, const std::string& frequency,
                                    double initialCapital = 10000.0);
 
+    /**
+     * @brief Same as above on ID-indexed tables, so the monthly loop does no string lookups.
+     *        Build the tables once with MacroScorer::toSeriesTable() and toReturnTable()
+     *        when running many configs over the same data.
+     */
+    static MacroBacktestResult run(const nlohmann::json& config, const FredSeriesTable& fredData,
+                                   const AssetReturnTable& assetReturns, const std::vector<std::string>& dates,
+                                   const std::string& frequency, double initialCapital = 10000.0);
+
+    /**
+     * @brief Convert an asset-class-keyed map of returns into an ID-indexed table (interning the keys).
+     */
+    static AssetReturnTable toReturnTable(const std::map<std::string, std::vector<double>>& assetReturns);
+
     /**
      * @brief Compute benchmark (buy-and-hold) result from a single asset's returns.
      */
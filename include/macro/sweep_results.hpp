@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+
+/**
+ * @brief One sweep cell (portfolio × strategy × period) as stored in a results file.
+ */
+struct SweepRecord {
+    /**
+     * @brief Index used for the portfolio and strategy of benchmark (buy-and-hold) cells.
+     */
+    static constexpr uint32_t kBenchmark = std::numeric_limits<uint32_t>::max();
+
+    uint32_t portfolio      = 0;
+    uint32_t strategy       = 0;
+    uint32_t period         = 0;
+    uint32_t rebalanceCount = 0;
+    double   cagr           = 0.0;
+    double   sharpe         = 0.0;
+    double   mdd            = 0.0;
+    double   totalReturnPct = 0.0;
+};
+
+static_assert(sizeof(SweepRecord) == 48, "SweepRecord must stay 48 bytes for the on-disk format");
+
+/**
+ * @brief Per-(portfolio, strategy) aggregate over all periods of a sweep.
+ *
+ * Averages divide by the number of periods of the sweep, so cells that were
+ * skipped (not enough data) count as zero, and worstMdd starts at 0.
+ */
+struct SweepSummary {
+    uint32_t portfolio = 0;
+    uint32_t strategy  = 0;
+    double   avgCagr   = 0.0;
+    double   avgSharpe = 0.0;
+    double   worstMdd  = 0.0;
+};
+
+/**
+ * @brief Streams sweep cells to a results file as they complete.
+ *
+ * The file starts with a small header (magic, record size, and the portfolio,
+ * strategy and period names) followed by fixed-width SweepRecords, so memory
+ * use is one stdio buffer regardless of the grid size.
+ */
+class SweepResultsWriter {
+   public:
+    /**
+     * @brief Create (truncate) a results file and write its header.
+     */
+    SweepResultsWriter(const std::string& path, const std::vector<std::string>& portfolios,
+                       const std::vector<std::string>& strategies, const std::vector<std::string>& periods);
+    ~SweepResultsWriter();
+
+    SweepResultsWriter(const SweepResultsWriter& other) = delete;
+    SweepResultsWriter& operator=(const SweepResultsWriter& other) = delete;
+
+    [[nodiscard]] bool ok() const { return file_ != nullptr; }
+
+    /**
+     * @brief Append one cell.
+     */
+    bool append(const SweepRecord& record);
+
+    /**
+     * @brief Flush buffered records to the file.
+     */
+    bool flush();
+
+    [[nodiscard]] std::size_t size() const { return count_; }
+
+   private:
+    std::FILE*  file_  = nullptr;
+    std::size_t count_ = 0;
+};
+
+/**
+ * @brief Read-only memory-mapped view of a results file, with ranking queries.
+ */
+class SweepResults {
+   public:
+    SweepResults() = default;
+    ~SweepResults();
+
+    SweepResults(const SweepResults& other) = delete;
+    SweepResults(SweepResults&& other) noexcept;
+
+    SweepResults& operator=(const SweepResults& other) = delete;
+    SweepResults& operator=(SweepResults&& other) noexcept;
+
+    /**
+     * @brief Map a results file.
+     * @return An empty view if the file is missing or not a results file.
+     */
+    [[nodiscard]] static SweepResults open(const std::string& path);
+
+    [[nodiscard]] const SweepRecord* begin() const { return records_; }
+    [[nodiscard]] const SweepRecord* end() const { return records_ + size_; }
+
+    [[nodiscard]] std::size_t size() const { return size_; }
+    [[nodiscard]] bool        empty() const { return size_ == 0; }
+
+    [[nodiscard]] const SweepRecord& operator[](std::size_t i) const { return records_[i]; }
+
+    [[nodiscard]] const std::vector<std::string>& portfolios() const { return portfolios_; }
+    [[nodiscard]] const std::vector<std::string>& strategies() const { return strategies_; }
+    [[nodiscard]] const std::vector<std::string>& periods() const { return periods_; }
+
+    /**
+     * @brief The k records with the highest score, best first.
+     *        Uses a size-k heap, so memory does not grow with the file.
+     * @param filter Optional predicate; records it rejects are ignored.
+     */
+    [[nodiscard]] std::vector<SweepRecord> topK(std::size_t k, const std::function<double(const SweepRecord&)>& score,
+                                                const std::function<bool(const SweepRecord&)>& filter = {}) const;
+
+    /**
+     * @brief Aggregate every (portfolio, strategy) pair over the periods in one pass.
+     *        Benchmark cells are skipped. Result is indexed by portfolio * strategies().size() + strategy.
+     */
+    [[nodiscard]] std::vector<SweepSummary> summarize() const;
+
+   private:
+    void*              base_    = nullptr;
+    std::size_t        length_  = 0;
+    const SweepRecord* records_ = nullptr;
+    std::size_t        size_    = 0;
+
+    std::vector<std::string> portfolios_;
+    std::vector<std::string> strategies_;
+    std::vector<std::string> periods_;
+};
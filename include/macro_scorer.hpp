@@ -9,6 +9,12 @@
 
 #include "fng_info.hpp"
 #include "fred_info.hpp"
+#include "symbol_table.hpp"
+
+/**
+ * @brief FRED series indexed by the SymbolTable::global() ID of their series ID; absent series are null.
+ */
+using FredSeriesTable = std::vector<std::shared_ptr<FredSeriesInfo>>;
 
 struct MacroScores {
     double growth    = 0.0;  // 0-100 (high = strong economy)
@@ -66,6 +72,17 @@ class MacroScorer {
     static MacroScores computeScoresAt(const std::map<std::string, std::shared_ptr<FredSeriesInfo>>& fredData,
                                        size_t                                                        index);
 
+    /**
+     * @brief Same as above on an ID-indexed table; no string lookups per call.
+     *        Prefer this in loops and convert once with toSeriesTable().
+     */
+    static MacroScores computeScoresAt(const FredSeriesTable& fredData, size_t index);
+
+    /**
+     * @brief Convert a series-ID-keyed map into an ID-indexed table (interning the IDs).
+     */
+    static FredSeriesTable toSeriesTable(const std::map<std::string, std::shared_ptr<FredSeriesInfo>>& fredData);
+
     /**
      * @brief Compute weighted composite score from category scores.
      */
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "stock_info.hpp"
+
+/**
+ * @brief Multi-ticker price panel on a shared, aligned time axis.
+ *
+ * Stores N tickers x T timestamps as column-major contiguous matrices, so the
+ * history of one ticker is a single contiguous run of T doubles:
+ *
+ *   close(col)[row] == closes_[col * rows() + row]
+ *
+ * The time axis is the sorted union of the timestamps of every input series.
+ * A bar that a ticker does not have, or whose close is not finite (a null
+ * bar), is marked as missing in the validity bitmap; its close carries the last observed close forward (0.0 before the
+ * first observation) and its return is 0.0.
+ */
+class Panel {
+   public:
+    Panel() = default;
+
+    /**
+     * @brief Build a panel from many StockInfos.
+     *
+     * The time axis is produced with a k-way merge of the (sorted) timestamp
+     * columns, so construction is O(N*T*log N) with no per-bar hashing.
+     * Null entries are kept as all-missing columns to preserve column order.
+     *
+     * @param stocks Input series; column order follows this vector.
+     */
+    [[nodiscard]] static Panel fromStocks(const std::vector<std::shared_ptr<StockInfo>>& stocks);
+
+    /**
+     * @brief Build a panel from many StockInfos (non-owning).
+     */
+    [[nodiscard]] static Panel fromStocks(const std::vector<const StockInfo*>& stocks);
+
+    /**
+     * @brief Number of timestamps (T).
+     */
+    [[nodiscard]] std::size_t rows() const { return timestamps_.size(); }
+
+    /**
+     * @brief Number of tickers (N).
+     */
+    [[nodiscard]] std::size_t cols() const { return tickers_.size(); }
+
+    [[nodiscard]] const std::vector<int64_t>&     timestamps() const { return timestamps_; }
+    [[nodiscard]] const std::vector<std::string>& tickers() const { return tickers_; }
+
+    /**
+     * @brief Column index of a ticker, or -1 if absent.
+     */
+    [[nodiscard]] std::ptrdiff_t find(const std::string& ticker) const;
+
+    /**
+     * @brief Contiguous close column of a ticker (length rows()).
+     */
+    [[nodiscard]] const double* close(std::size_t col) const { return closes_.data() + col * rows(); }
+
+    /**
+     * @brief Contiguous simple-return column of a ticker (length rows()).
+     *
+     * returns(col)[row] = close[row] / close[prev] - 1, where prev is the
+     * previous valid bar. 0.0 for the first valid bar and for missing bars.
+     */
+    [[nodiscard]] const double* returns(std::size_t col) const { return returns_.data() + col * rows(); }
+
+    [[nodiscard]] double close(std::size_t col, std::size_t row) const { return closes_[col * rows() + row]; }
+    [[nodiscard]] double returns(std::size_t col, std::size_t row) const { return returns_[col * rows() + row]; }
+
+    /**
+     * @brief Validity bitmap of a column, one bit per row (LSB first).
+     */
+    [[nodiscard]] const uint64_t* validity(std::size_t col) const { return valid_.data() + col * words_; }
+
+    /**
+     * @brief True if the ticker has an actual bar at this row.
+     */
+    [[nodiscard]] bool valid(std::size_t col, std::size_t row) const {
+        return (validity(col)[row >> 6] >> (row & 63)) & 1U;
+    }
+
+   private:
+    std::vector<int64_t>     timestamps_;
+    std::vector<std::string> tickers_;
+
+    // Column-major N x T matrices.
+    std::vector<double> closes_;
+    std::vector<double> returns_;
+
+    // Column-major N x words_ bitmap.
+    std::vector<uint64_t> valid_;
+    std::size_t           words_ = 0;
+};
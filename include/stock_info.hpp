@@ -1,9 +1,52 @@
 #pragma once
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <utility>
 #include <vector>
 
+/**
+ * @brief Cash dividend, effective from its ex-date bar.
+ */
+struct Dividend {
+    int64_t timestamp = 0;  // ex-date (Unix timestamp)
+    double  amount    = 0.0;
+};
+
+/**
+ * @brief Stock split of numerator-for-denominator shares (e.g., 4:1), effective from its bar.
+ */
+struct Split {
+    int64_t timestamp   = 0;
+    double  numerator   = 1.0;
+    double  denominator = 1.0;
+};
+
+/**
+ * @brief Which corporate actions StockInfo::adjust() folds into the prices.
+ */
+enum class AdjustMode
+{
+    Dividends,           // Yahoo quote prices are already split-adjusted
+    SplitsAndDividends,  // fully raw prices (e.g., vendor CSV files)
+};
+
+/**
+ * @brief Back-adjusted copy of the OHLC columns, aligned to the raw bars.
+ */
+struct AdjustedPrices {
+    std::vector<double> factor;  // price multiplier of each bar (1.0 after the last action)
+    std::vector<double> open;
+    std::vector<double> high;
+    std::vector<double> low;
+    std::vector<double> close;
+};
+
 struct StockInfo {
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
     /**
      * @brief
      * @example "AAPL", "GOOGL", etc.
@@ -85,7 +128,8 @@ struct StockInfo {
     std::vector<double> low;
 
     /**
-     * @brief
+     * @brief Close prices; NaN on bars Yahoo reports as null (e.g., halts), as in open/high/low.
+     *        See indicator/gaps.hpp for indicators over such gaps.
      * @example [100.0, 101.0, ...]
      */
     std::vector<double> close;
@@ -95,4 +139,94 @@ struct StockInfo {
      * @example [100.0, 101.0, ...]
      */
     std::vector<int64_t> volume;
+
+    /**
+     * @brief Yahoo's split- and dividend-adjusted close (daily and longer intervals only).
+     * @example [99.1, 100.2, ...]
+     */
+    std::vector<double> adjclose;
+
+    /* CORPORATE ACTIONS (sorted by timestamp) */
+
+    std::vector<Dividend> dividends;
+    std::vector<Split>    splits;
+
+    /**
+     * @brief Cache filled by adjust(); empty until then.
+     */
+    AdjustedPrices adjusted;
+
+    /**
+     * @brief Version of the columns, drawn from a process-wide counter.
+     *
+     * A new object and every library writer of the columns (yFinance decoding,
+     * CsvReader, CompressedSeries::decode, PriceGenerator, adjust()) draw a
+     * value never drawn before; code that edits the columns itself calls
+     * touch(). A copy keeps the version of its source, so the version alone
+     * does not identify an object: IndicatorCache keys results by the column
+     * buffer together with it (see SeriesKey).
+     */
+    uint64_t version = nextVersion();
+
+    /**
+     * @brief Mark the columns as changed (draws a new version).
+     */
+    void touch() { version = nextVersion(); }
+
+    [[nodiscard]] static uint64_t nextVersion();
+
+    /**
+     * @brief Back-adjust open/high/low/close for the corporate actions into `adjusted`.
+     *
+     * One reverse pass over the (sparse) actions builds the cumulative factor of
+     * every bar: a dividend multiplies earlier bars by (1 - amount / previous close),
+     * a split by denominator / numerator. The columns are then scaled element-wise
+     * in flat loops the compiler vectorizes. Actions after the last bar are ignored.
+     * Reuses the capacity of `adjusted`, so re-adjusting after a refetch does not allocate.
+     */
+    void adjust(AdjustMode mode = AdjustMode::Dividends);
+
+    /* TIME INDEX (timestamps must be sorted ascending) */
+
+    /**
+     * @brief Index of the first bar with timestamp >= ts (binary search).
+     * @return timestamps.size() if every bar is earlier than ts.
+     */
+    [[nodiscard]] std::size_t lowerBound(int64_t ts) const {
+        return static_cast<std::size_t>(std::lower_bound(timestamps.begin(), timestamps.end(), ts)
+                                        - timestamps.begin());
+    }
+
+    /**
+     * @brief Index of the first bar with timestamp > ts (binary search).
+     * @return timestamps.size() if no bar is later than ts.
+     */
+    [[nodiscard]] std::size_t upperBound(int64_t ts) const {
+        return static_cast<std::size_t>(std::upper_bound(timestamps.begin(), timestamps.end(), ts)
+                                        - timestamps.begin());
+    }
+
+    /**
+     * @brief Half-open index range [first, last) of bars with start <= timestamp < end.
+     */
+    [[nodiscard]] std::pair<std::size_t, std::size_t> range(int64_t start, int64_t end) const {
+        const auto first = lowerBound(start);
+        return {first, std::max(first, lowerBound(end))};
+    }
+
+    /**
+     * @brief Index of the first bar on a UTC date.
+     * @param date Date (YYYY-MM-DD)
+     * @return npos if there is no bar on that date or the date is malformed.
+     */
+    [[nodiscard]] std::size_t indexOf(const std::string& date) const;
+
+    /**
+     * @brief Half-open index range [first, last) of bars whose UTC date lies in [startDate, endDate].
+     * @param startDate Inclusive start date (YYYY-MM-DD)
+     * @param endDate   Inclusive end date (YYYY-MM-DD)
+     * @return {0, 0} if either date is malformed.
+     */
+    [[nodiscard]] std::pair<std::size_t, std::size_t> range(const std::string& startDate,
+                                                            const std::string& endDate) const;
 };
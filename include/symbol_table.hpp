@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @brief Dense integer ID of an interned symbol (ticker, FRED series ID, asset-class key, ...).
+ */
+using SymbolId = uint32_t;
+
+/**
+ * @brief Thread-safe interning table mapping symbols to dense integer IDs.
+ *
+ * IDs are assigned in interning order starting at 0 and never change, so they
+ * can index plain vectors in place of string-keyed maps. Symbol names are
+ * stored once and stay valid for the lifetime of the table.
+ */
+class SymbolTable {
+   public:
+    static constexpr SymbolId kInvalid = std::numeric_limits<SymbolId>::max();
+
+    SymbolTable() = default;
+
+    SymbolTable(const SymbolTable& other) = delete;
+    SymbolTable& operator=(const SymbolTable& other) = delete;
+
+    /**
+     * @brief Process-wide table shared by the library APIs.
+     */
+    [[nodiscard]] static SymbolTable& global();
+
+    /**
+     * @brief ID of a symbol, assigning the next free ID on first use.
+     */
+    SymbolId intern(std::string_view name);
+
+    /**
+     * @brief ID of a symbol, or kInvalid if it was never interned.
+     */
+    [[nodiscard]] SymbolId find(std::string_view name) const;
+
+    /**
+     * @brief Name of an interned symbol. Empty for unknown IDs.
+     */
+    [[nodiscard]] std::string_view name(SymbolId id) const;
+
+    /**
+     * @brief Number of interned symbols (one past the largest ID).
+     */
+    [[nodiscard]] std::size_t size() const;
+
+   private:
+    mutable std::shared_mutex                      mutex_;
+    std::deque<std::string>                        names_;  // stable addresses for the views in ids_
+    std::unordered_map<std::string_view, SymbolId> ids_;
+};
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "fred_info.hpp"
+#include "stock_info.hpp"
+
+/**
+ * @brief Seeded synthetic market data for offline benchmarks and stress tests.
+ *
+ * Everything is a pure function of the seed, so a run is reproducible on any
+ * machine without network access. Prices are generated in chunks, so paths of
+ * 10^9 bars can be streamed through a fixed-size StockInfo.
+ */
+namespace synthetic {
+
+/**
+ * @brief xoshiro256+ generator with four interleaved lanes.
+ *
+ * The lanes are stepped together in structure-of-arrays form, so the fill loops
+ * compile to SIMD shifts/xors/adds (no 64-bit multiply). The top 53 bits of
+ * xoshiro256+ are used for doubles, which is what the generator is designed for.
+ */
+class Rng {
+   public:
+    /**
+     * @brief Seed all lanes from one 64-bit seed (expanded with splitmix64).
+     */
+    explicit Rng(uint64_t seed = 0);
+
+    /**
+     * @brief Uniform doubles in [0, 1).
+     */
+    void fillUniform(double* out, std::size_t n);
+
+    /**
+     * @brief Standard normal doubles (128-layer ziggurat over a block of raw draws).
+     */
+    void fillNormal(double* out, std::size_t n);
+
+    [[nodiscard]] uint64_t next();
+    [[nodiscard]] double   uniform();
+
+   private:
+    static constexpr std::size_t kLanes = 4;
+
+    void   fillBits(uint64_t* out, std::size_t n);
+    double slowNormal(double u, unsigned layer);
+
+    uint64_t    s_[4][kLanes] = {};  // s_[word][lane]
+    std::size_t lane_         = 0;   // next lane for scalar draws
+};
+
+/**
+ * @brief Price model: geometric Brownian motion with optional Merton jumps.
+ *
+ * Log return per bar = (drift - volatility^2 / 2) * dt + volatility * sqrt(dt) * Z
+ * plus, with probability jumpIntensity * dt, a jump ~ N(jumpMean, jumpStdDev).
+ * dt = 1 / barsPerYear.
+ */
+struct PriceModel {
+    double initialPrice  = 100.0;
+    double drift         = 0.07;  // annualized
+    double volatility    = 0.20;  // annualized
+    double jumpIntensity = 0.0;   // expected jumps per year
+    double jumpMean      = 0.0;   // mean log jump size
+    double jumpStdDev    = 0.0;
+    double barsPerYear   = 252.0;
+
+    int64_t startTimestamp = 946857600;  // 2000-01-03 00:00 UTC
+    int64_t barSeconds     = 86400;
+
+    /**
+     * @brief Probability that a bar is dropped (a gap in the timestamps).
+     *        The price keeps moving underneath, so the next bar gaps as in real feeds.
+     */
+    double missingRate = 0.0;
+
+    double averageVolume = 1e6;  // volume is log-normal around this
+};
+
+/**
+ * @brief Streams one ticker's OHLCV path chunk by chunk.
+ */
+class PriceGenerator {
+   public:
+    PriceGenerator(std::string ticker, const PriceModel& model, uint64_t seed);
+
+    /**
+     * @brief Overwrite `out` with the next `steps` bars of the path, minus the missing ones.
+     *        Reuses the capacity of `out` (and of the generator's scratch buffers), so a
+     *        long path can be streamed through one StockInfo without allocating.
+     * @return Number of bars written.
+     */
+    std::size_t next(StockInfo& out, std::size_t steps);
+
+    [[nodiscard]] double  lastClose() const { return close_; }
+    [[nodiscard]] int64_t nextTimestamp() const { return timestamp_; }
+
+   private:
+    std::string ticker_;
+    PriceModel  model_;
+    Rng         rng_;
+    double      close_     = 0.0;
+    int64_t     timestamp_ = 0;
+
+    std::vector<double> normals_;
+    std::vector<double> uniforms_;
+};
+
+/**
+ * @brief Generate a whole path of `steps` bars.
+ */
+[[nodiscard]] std::shared_ptr<StockInfo> generateStock(const std::string& ticker, std::size_t steps,
+                                                       const PriceModel& model = {}, uint64_t seed = 0);
+
+/**
+ * @brief Generate `tickers` independent paths named "SYN00000", "SYN00001", ...
+ *        Ticker i uses its own stream derived from (seed, i), so adding tickers
+ *        does not change the existing ones.
+ */
+[[nodiscard]] std::vector<std::shared_ptr<StockInfo>> generateUniverse(std::size_t tickers, std::size_t steps,
+                                                                       const PriceModel& model = {},
+                                                                       uint64_t          seed  = 0);
+
+/**
+ * @brief Regime-dependent behaviour of one monthly series.
+ *
+ * Level series mean-revert toward the regime's target (AR(1));
+ * growth series compound at the regime's monthly growth rate.
+ */
+struct MacroSeriesModel {
+    std::string id;
+    bool        growth    = false;
+    double      initial   = 0.0;
+    double      expansion = 0.0;  // target level, or monthly growth rate
+    double      recession = 0.0;
+    double      noise     = 0.0;  // std-dev of the monthly shock (relative for growth series)
+    double      reversion = 0.2;  // speed of mean reversion of level series
+};
+
+/**
+ * @brief Regime-dependent monthly return of one asset class.
+ */
+struct MacroAssetModel {
+    std::string name;
+    double      expansionMean = 0.0;
+    double      recessionMean = 0.0;
+    double      volatility    = 0.0;
+};
+
+/**
+ * @brief Two-state (expansion/recession) Markov regime model of the economy.
+ *
+ * The defaults cover every series MacroScorer reads and the asset classes of
+ * config/macro_allocation.json, with roughly post-war US magnitudes.
+ */
+struct MacroModel {
+    std::size_t months           = 360;
+    int64_t     startYear        = 1990;
+    double      enterRecession   = 0.02;  // monthly transition probabilities
+    double      leaveRecession   = 0.10;
+    bool        startInRecession = false;
+
+    std::vector<MacroSeriesModel> series = defaultSeries();
+    std::vector<MacroAssetModel>  assets = defaultAssets();
+
+    [[nodiscard]] static std::vector<MacroSeriesModel> defaultSeries();
+    [[nodiscard]] static std::vector<MacroAssetModel>  defaultAssets();
+};
+
+/**
+ * @brief Output of generateMacro(), shaped for MacroBacktester::run().
+ */
+struct SyntheticMacro {
+    std::vector<std::string>                               dates;      // "YYYY-MM-01", one per month
+    std::vector<uint8_t>                                   recession;  // 1 in recession months
+    std::map<std::string, std::shared_ptr<FredSeriesInfo>> series;
+    std::map<std::string, std::vector<double>>             assetReturns;  // aligned to dates
+};
+
+/**
+ * @brief Generate regime-switching FRED series and asset-class returns.
+ */
+[[nodiscard]] SyntheticMacro generateMacro(const MacroModel& model = {}, uint64_t seed = 0);
+
+}  // namespace synthetic
@@ -9,6 +9,20 @@
 #include "fred_info.hpp"
 #include "stock_info.hpp"
 
+class ParseArena;
+
+/**
+ * @brief Outcome of a fetch that fills a caller-owned container.
+ */
+enum class FetchStatus
+{
+    Ok,
+    NetworkError,  // request failed or returned an empty body
+    ParseError,    // body is not valid JSON or has an unexpected shape
+    NoData,        // valid response without any data (e.g., unknown ticker)
+    ApiError,      // the API reported an error (e.g., invalid FRED key)
+};
+
 class yFinance {
    public:
     static void init();
@@ -28,7 +42,7 @@ class yFinance {
      * @param ticker Stock ticker (e.g., "AAPL")
      * @param interval Data interval (e.g., "1d", "1wk", "1mo")
      * @param range Data range (e.g., "1y", "5y", "max")
-     * @return StockInfo containing historical time-series
+     * @return StockInfo containing historical time-series, or nullptr unless the fetch succeeded
      */
     [[nodiscard]] static std::shared_ptr<StockInfo>
     getStockInfo(const std::string& ticker, const std::string& interval = "1d", const std::string& range = "1mo");
@@ -39,13 +53,42 @@ class yFinance {
      * @param startDate Start date (YYYY-MM-DD)
      * @param endDate End date (YYYY-MM-DD)
      * @param interval Data interval
-     * @return StockInfo
+     * @return StockInfo, or nullptr unless the fetch succeeded
      */
     [[nodiscard]] static std::shared_ptr<StockInfo> getStockInfo(const std::string& ticker,
                                                                  const std::string& startDate,
                                                                  const std::string& endDate,
                                                                  const std::string& interval);
 
+    /**
+     * @brief Fetch historical stock data into a caller-owned StockInfo.
+     *
+     * Column vectors are overwritten in place and keep their capacity, so a
+     * refresh loop reusing the same StockInfo does not reallocate them.
+     *
+     * @param out      Destination. Left in an unspecified state unless Ok is returned.
+     * @param ticker   Stock ticker (e.g., "AAPL")
+     * @param interval Data interval (e.g., "1d", "1wk", "1mo")
+     * @param range    Data range (e.g., "1y", "5y", "max")
+     * @return FetchStatus::Ok on success
+     */
+    [[nodiscard]] static FetchStatus getStockInfo(StockInfo& out, const std::string& ticker,
+                                                  const std::string& interval = "1d",
+                                                  const std::string& range    = "1mo");
+
+    /**
+     * @brief Fetch historical stock data with date range into a caller-owned StockInfo.
+     * @param out       Destination. Left in an unspecified state unless Ok is returned.
+     * @param ticker    Stock ticker
+     * @param startDate Start date (YYYY-MM-DD)
+     * @param endDate   End date (YYYY-MM-DD)
+     * @param interval  Data interval
+     * @return FetchStatus::Ok on success
+     */
+    [[nodiscard]] static FetchStatus getStockInfo(StockInfo& out, const std::string& ticker,
+                                                  const std::string& startDate, const std::string& endDate,
+                                                  const std::string& interval);
+
     /**
      * @brief Fetch FRED economic data series (e.g., UNRATE, FEDFUNDS).
      * @param seriesId FRED series ID (e.g., "UNRATE", "FEDFUNDS")
@@ -60,12 +103,64 @@ class yFinance {
     getFredSeries(const std::string& seriesId, const std::string& apiKey, const std::string& observationStart = "",
                   const std::string& observationEnd = "", const std::string& frequency = "");
 
+    /**
+     * @brief Fetch FRED economic data series into a caller-owned FredSeriesInfo.
+     * @param out Destination. Left in an unspecified state unless Ok is returned.
+     * @see getFredSeries(const std::string&, const std::string&, const std::string&, const std::string&,
+     *      const std::string&)
+     * @return FetchStatus::Ok on success
+     */
+    [[nodiscard]] static FetchStatus getFredSeries(FredSeriesInfo& out, const std::string& seriesId,
+                                                   const std::string& apiKey, const std::string& observationStart = "",
+                                                   const std::string& observationEnd = "",
+                                                   const std::string& frequency      = "");
+
     /**
      * @brief Fetch CNN Fear and Greed Index.
      * @return FearAndGreedInfo containing current and historical sentiment index
      */
     [[nodiscard]] static std::shared_ptr<FearAndGreedInfo> getFearAndGreedIndex();
 
+    /**
+     * @brief Fetch CNN Fear and Greed Index into a caller-owned FearAndGreedInfo.
+     * @param out Destination. Left in an unspecified state unless Ok is returned.
+     * @return FetchStatus::Ok on success
+     */
+    [[nodiscard]] static FetchStatus getFearAndGreedIndex(FearAndGreedInfo& out);
+
+    /**
+     * @brief Decode a Yahoo chart API response body.
+     * @param body   Raw JSON response.
+     * @param ticker Ticker to record in out.ticker.
+     * @param out    Destination; columns are overwritten in place and every other field
+     *               is reset, so nothing of a previous ticker survives. Unless Ok is
+     *               returned, out is left empty (all columns cleared).
+     */
+    [[nodiscard]] static FetchStatus parseStockInfo(std::string_view body, const std::string& ticker, StockInfo& out);
+
+    /**
+     * @brief Decode into `out` with the JSON temporaries in a caller-owned arena.
+     *
+     * The arena is released first, so one arena reused across calls (sized for
+     * the responses, see ParseArena) together with a reused StockInfo keeps the
+     * document and the columns off the heap. Only the JSON parser's own small
+     * stacks are still allocated per call.
+     */
+    [[nodiscard]] static FetchStatus parseStockInfo(std::string_view body, const std::string& ticker, StockInfo& out,
+                                                    ParseArena& arena);
+
+    /**
+     * @brief Decode a FRED series/observations response body.
+     *        Observations marked as missing (".") are skipped.
+     */
+    [[nodiscard]] static FetchStatus parseFredSeries(std::string_view body, const std::string& seriesId,
+                                                     FredSeriesInfo& out);
+
+    /**
+     * @brief Decode a CNN Fear and Greed graphdata response body.
+     */
+    [[nodiscard]] static FetchStatus parseFearAndGreed(std::string_view body, FearAndGreedInfo& out);
+
    private:
     static constexpr std::string_view url_base_      = "https://query1.finance.yahoo.com/v8/finance/chart/";
     static constexpr std::string_view cnn_url_base_  = "https://production.dataviz.cnn.io/index/fearandgreed/graphdata";
@@ -73,5 +168,11 @@ class yFinance {
 
     [[nodiscard]] static std::string fetch(const std::string& url, bool is_cnn = false);
 
+    /**
+     * @brief Fetch into an existing buffer (cleared first, capacity kept).
+     * @return true if the request succeeded and the body is not empty.
+     */
+    static bool fetch(const std::string& url, std::string& buffer, bool is_cnn = false);
+
     static std::size_t write(void* contents, std::size_t size, std::size_t nmemb, void* userp);
 };
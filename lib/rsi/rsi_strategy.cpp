@@ -1,11 +1,17 @@
 #include "rsi_strategy.hpp"
 
-#include "indicator.hpp"
+#include "indicator/gaps.hpp"
 
-RsiStrategy::RsiStrategy(std::size_t period, double oversold, double overbought)
+RsiStrategy::RsiStrategy(std::size_t                period,
+                         double                     oversold,
+                         double                     overbought,
+                         indicator::IndicatorCache* cache,
+                         indicator::GapPolicy       gaps)
     : period_(period)
     , oversold_(oversold)
-    , overbought_(overbought) {}
+    , overbought_(overbought)
+    , cache_(cache)
+    , gaps_(gaps) {}
 
 std::string RsiStrategy::name() const {
     return "RSI (" + std::to_string(period_) + ", " + std::to_string(static_cast<int>(oversold_)) + "/"
@@ -13,7 +19,12 @@ std::string RsiStrategy::name() const {
 }
 
 void RsiStrategy::init(const StockInfo& data) {
-    rsi_ = indicator::rsi(data.close, period_);
+    if (cache_ != nullptr) {
+        shared_ = cache_->alignedRsi(data.close, data.version, period_, gaps_);
+    } else {
+        shared_.reset();
+        indicator::rsiInto(data.close, period_, gaps_, buffer_);
+    }
 }
 
 std::size_t RsiStrategy::warmupPeriod() const {
@@ -21,16 +32,13 @@ std::size_t RsiStrategy::warmupPeriod() const {
 }
 
 Signal RsiStrategy::evaluate(const StockInfo& /* data */, std::size_t index) {
-    if (index <= period_) {
-        return Signal::HOLD;
-    }
-
-    const auto rsiIdx = index - period_ - 1;
-    if (rsiIdx >= rsi_.size()) {
+    // Act on the RSI of the previous bar
+    const auto& values = rsi();
+    if (index <= period_ || index > values.size()) {
         return Signal::HOLD;
     }
 
-    const double val = rsi_[rsiIdx];
+    const double val = values[index - 1];
 
     // Oversold → BUY
     if (val <= oversold_) {
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+#include "indicator/cache.hpp"
 #include "strategy/istrategy.hpp"
 
 /**
@@ -18,8 +19,16 @@ class RsiStrategy: public IStrategy {
      * @param period     RSI lookback period (default: 14 days).
      * @param oversold   RSI threshold for BUY signal (default: 30).
      * @param overbought RSI threshold for SELL signal (default: 70).
+     * @param cache      Optional shared indicator cache, so strategies over the same data
+     *                   compute each RSI once. Must outlive init() calls.
+     * @param gaps       How missing (NaN) closes enter the RSI. No signal is given
+     *                   while the RSI of the previous bar is NaN.
      */
-    explicit RsiStrategy(std::size_t period = 14, double oversold = 30.0, double overbought = 70.0);
+    explicit RsiStrategy(std::size_t                period     = 14,
+                         double                     oversold   = 30.0,
+                         double                     overbought = 70.0,
+                         indicator::IndicatorCache* cache      = nullptr,
+                         indicator::GapPolicy       gaps       = indicator::GapPolicy::Skip);
 
     [[nodiscard]] std::string name() const override;
 
@@ -30,10 +39,15 @@ class RsiStrategy: public IStrategy {
     [[nodiscard]] Signal evaluate(const StockInfo& data, std::size_t index) override;
 
    private:
-    std::size_t period_;
-    double      oversold_;
-    double      overbought_;
+    std::size_t                period_;
+    double                     oversold_;
+    double                     overbought_;
+    indicator::IndicatorCache* cache_;
+    indicator::GapPolicy       gaps_;
 
-    // Cached RSI values. rsi_[i] corresponds to data index (period_ + i).
-    std::vector<double> rsi_;
+    // RSI aligned to the data index (NaN during warm-up): the cached row, or else the workspace
+    [[nodiscard]] const std::vector<double>& rsi() const { return shared_ ? *shared_ : buffer_; }
+
+    indicator::IndicatorCache::Values shared_;
+    std::vector<double>               buffer_;  // reused across init() calls
 };
@@ -1,12 +1,15 @@
 #include "sma_crossover.hpp"
 
-#include <algorithm>
+#include "indicator/gaps.hpp"
 
-#include "indicator.hpp"
-
-SmaCrossover::SmaCrossover(std::size_t shortWindow, std::size_t longWindow)
+SmaCrossover::SmaCrossover(std::size_t                shortWindow,
+                           std::size_t                longWindow,
+                           indicator::IndicatorCache* cache,
+                           indicator::GapPolicy       gaps)
     : shortWindow_(shortWindow)
-    , longWindow_(longWindow) {}
+    , longWindow_(longWindow)
+    , cache_(cache)
+    , gaps_(gaps) {}
 
 std::string SmaCrossover::name() const {
     return "SMA Crossover (" + std::to_string(shortWindow_) + "/" + std::to_string(longWindow_) + ")";
@@ -15,24 +18,15 @@ std::string SmaCrossover::name() const {
 void SmaCrossover::init(const StockInfo& data) {
     const auto& prices = data.close;
 
-    auto rawShort = indicator::sma(prices, shortWindow_);
-    auto rawLong  = indicator::sma(prices, longWindow_);
-
-    // rawShort starts at index (shortWindow_ - 1) of original data.
-    // rawLong  starts at index (longWindow_  - 1) of original data.
-    // We align both to start at index (longWindow_ - 1).
-    // rawShort needs to be trimmed from the front by (longWindow_ - shortWindow_) elements.
-
-    const std::size_t offset = longWindow_ - shortWindow_;
-    if (offset < rawShort.size()) {
-        shortSma_.assign(rawShort.begin() + static_cast<long>(offset), rawShort.end());
+    if (cache_ != nullptr) {
+        shortShared_ = cache_->alignedSma(prices, data.version, shortWindow_, gaps_);
+        longShared_  = cache_->alignedSma(prices, data.version, longWindow_, gaps_);
+    } else {
+        shortShared_.reset();
+        longShared_.reset();
+        indicator::smaInto(prices, shortWindow_, gaps_, shortBuffer_);
+        indicator::smaInto(prices, longWindow_, gaps_, longBuffer_);
     }
-    longSma_ = std::move(rawLong);
-
-    // Ensure both are the same length
-    const auto minLen = std::min(shortSma_.size(), longSma_.size());
-    shortSma_.resize(minLen);
-    longSma_.resize(minLen);
 }
 
 std::size_t SmaCrossover::warmupPeriod() const {
@@ -41,22 +35,17 @@ std::size_t SmaCrossover::warmupPeriod() const {
 }
 
 Signal SmaCrossover::evaluate(const StockInfo& /* data */, std::size_t index) {
-    // Map data index to our aligned SMA index
-    if (index < longWindow_) {
-        return Signal::HOLD;
-    }
-
-    const auto smaIdx = index - longWindow_;
-
-    // Need at least 2 points for crossover detection
-    if (smaIdx == 0 || smaIdx >= shortSma_.size()) {
+    // Compare the SMAs of the two previous bars (index - 2 and index - 1)
+    const auto& shortValues = shortSma();
+    const auto& longValues  = longSma();
+    if (index <= longWindow_ || shortWindow_ > longWindow_ || index > longValues.size() || index > shortValues.size()) {
         return Signal::HOLD;
     }
 
-    const double prevShort = shortSma_[smaIdx - 1];
-    const double prevLong  = longSma_[smaIdx - 1];
-    const double currShort = shortSma_[smaIdx];
-    const double currLong  = longSma_[smaIdx];
+    const double prevShort = shortValues[index - 2];
+    const double prevLong  = longValues[index - 2];
+    const double currShort = shortValues[index - 1];
+    const double currLong  = longValues[index - 1];
 
     // Golden cross: short SMA crosses above long SMA
     if (prevShort <= prevLong && currShort > currLong) {
@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 
+#include "indicator/cache.hpp"
 #include "strategy/istrategy.hpp"
 
 /**
@@ -17,8 +18,15 @@ class SmaCrossover: public IStrategy {
     /**
      * @param shortWindow Short-term SMA window (default: 20 days).
      * @param longWindow  Long-term SMA window (default: 50 days).
+     * @param cache       Optional shared indicator cache, so strategies over the same data
+     *                    compute each SMA once. Must outlive init() calls.
+     * @param gaps        How missing (NaN) closes enter the SMAs. No signal is given
+     *                    while either SMA is NaN at the compared bars.
      */
-    explicit SmaCrossover(std::size_t shortWindow = 20, std::size_t longWindow = 50);
+    explicit SmaCrossover(std::size_t                shortWindow = 20,
+                          std::size_t                longWindow  = 50,
+                          indicator::IndicatorCache* cache       = nullptr,
+                          indicator::GapPolicy       gaps        = indicator::GapPolicy::Skip);
 
     [[nodiscard]] std::string name() const override;
 
@@ -29,11 +37,19 @@ class SmaCrossover: public IStrategy {
     [[nodiscard]] Signal evaluate(const StockInfo& data, std::size_t index) override;
 
    private:
-    std::size_t shortWindow_;
-    std::size_t longWindow_;
+    // SMAs aligned to the data index (NaN during warm-up): the cached rows, or else the workspace
+    [[nodiscard]] const std::vector<double>& shortSma() const { return shortShared_ ? *shortShared_ : shortBuffer_; }
+    [[nodiscard]] const std::vector<double>& longSma() const { return longShared_ ? *longShared_ : longBuffer_; }
 
-    // Cached SMA values aligned to data indices.
-    // shortSma_[i] and longSma_[i] correspond to data index (longWindow_ - 1 + i).
-    std::vector<double> shortSma_;
-    std::vector<double> longSma_;
+    std::size_t                shortWindow_;
+    std::size_t                longWindow_;
+    indicator::IndicatorCache* cache_;
+    indicator::GapPolicy       gaps_;
+
+    indicator::IndicatorCache::Values shortShared_;
+    indicator::IndicatorCache::Values longShared_;
+
+    // Workspace without a cache, reused across init() calls
+    std::vector<double> shortBuffer_;
+    std::vector<double> longBuffer_;
 };
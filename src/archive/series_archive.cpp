@@ -0,0 +1,403 @@
+#include "archive/series_archive.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <limits>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "civil_date.hpp"
+
+namespace {
+
+// Unknown fetch range (files written by plain appends or by the version 1 format)
+constexpr int32_t kNoFetch = std::numeric_limits<int32_t>::max();
+
+// Fetch without a start date: the whole remote history
+constexpr int32_t kFromBeginning = std::numeric_limits<int32_t>::min();
+
+struct FileHeader {
+    char     magic[8]    = {'Y', 'F', 'A', 'R', 'C', 'H', 'V', '2'};
+    uint32_t recordSize  = sizeof(ArchiveRecord);
+    int32_t  fetchedFrom = kNoFetch;  // earliest start day of the fetches merged into the file
+};
+
+static_assert(sizeof(FileHeader) == 16, "FileHeader must stay 16 bytes for the on-disk format");
+
+// Version 1 files have the same layout with a reserved, zero fetchedFrom
+bool versionOne(const FileHeader& header) {
+    return header.magic[7] == '1';
+}
+
+bool validHeader(const FileHeader& header) {
+    const FileHeader expected;
+    return std::memcmp(header.magic, expected.magic, sizeof(expected.magic) - 1) == 0
+        && (header.magic[7] == '1' || header.magic[7] == '2') && header.recordSize == expected.recordSize;
+}
+
+int32_t storedFrom(const FileHeader& header) {
+    return versionOne(header) ? kNoFetch : header.fetchedFrom;
+}
+
+std::vector<ArchiveRecord> fredRecords(const FredSeriesInfo& series) {
+    std::vector<ArchiveRecord> records;
+    records.reserve(series.values.size());
+
+    const auto n = std::min(series.dates.size(), series.values.size());
+    for (std::size_t i = 0; i < n; ++i) {
+        int64_t day = 0;
+        if (!civil::parseDate(series.dates[i], day)) {
+            continue;
+        }
+        ArchiveRecord r;
+        r.day   = static_cast<int32_t>(day);
+        r.value = series.values[i];
+        records.push_back(r);
+    }
+    return records;
+}
+
+bool writeAll(int fd, const void* data, std::size_t bytes, off_t offset) {
+    const auto* p = static_cast<const char*>(data);
+    while (bytes > 0) {
+        const auto n = ::pwrite(fd, p, bytes, offset);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        p += n;
+        bytes -= static_cast<std::size_t>(n);
+        offset += n;
+    }
+    return true;
+}
+
+}  // namespace
+
+MappedSeries::~MappedSeries() {
+    release();
+}
+
+MappedSeries::MappedSeries(MappedSeries&& other) noexcept
+    : fd_(other.fd_)
+    , base_(other.base_)
+    , length_(other.length_)
+    , records_(other.records_)
+    , size_(other.size_) {
+    other.fd_      = -1;
+    other.base_    = nullptr;
+    other.length_  = 0;
+    other.records_ = nullptr;
+    other.size_    = 0;
+}
+
+MappedSeries& MappedSeries::operator=(MappedSeries&& other) noexcept {
+    if (this != &other) {
+        release();
+        fd_            = other.fd_;
+        base_          = other.base_;
+        length_        = other.length_;
+        records_       = other.records_;
+        size_          = other.size_;
+        other.fd_      = -1;
+        other.base_    = nullptr;
+        other.length_  = 0;
+        other.records_ = nullptr;
+        other.size_    = 0;
+    }
+    return *this;
+}
+
+void MappedSeries::release() {
+    if (base_) {
+        ::munmap(base_, length_);
+    }
+    if (fd_ >= 0) {
+        ::flock(fd_, LOCK_UN);
+        ::close(fd_);
+    }
+    fd_      = -1;
+    base_    = nullptr;
+    length_  = 0;
+    records_ = nullptr;
+    size_    = 0;
+}
+
+SeriesArchive::SeriesArchive(std::string directory)
+    : directory_(std::move(directory)) {
+    if (::mkdir(directory_.c_str(), 0755) != 0 && errno != EEXIST) {
+        std::cerr << "Archive error: cannot create " << directory_ << ": " << std::strerror(errno) << std::endl;
+    }
+}
+
+std::string SeriesArchive::fredId(const std::string& seriesId, const std::string& frequency) {
+    return frequency.empty() ? seriesId : seriesId + "@" + frequency;
+}
+
+std::string SeriesArchive::path(const std::string& seriesId) const {
+    std::string name = seriesId;
+    std::replace(name.begin(), name.end(), '/', '_');
+    return directory_ + "/" + name + ".bin";
+}
+
+std::size_t SeriesArchive::append(const std::string& seriesId, const std::vector<ArchiveRecord>& records) const {
+    return merge(seriesId, records, kNoFetch);
+}
+
+std::size_t SeriesArchive::merge(const std::string&                seriesId,
+                                 const std::vector<ArchiveRecord>& records,
+                                 int32_t                           fetchStart) const {
+    if (records.empty()) {
+        return 0;
+    }
+
+    const auto file = path(seriesId);
+    const int  fd   = ::open(file.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        std::cerr << "Archive error: cannot open " << file << ": " << std::strerror(errno) << std::endl;
+        return 0;
+    }
+
+    // Exclude other writers and the readers of the same series
+    ::flock(fd, LOCK_EX);
+
+    std::size_t changed = 0;
+    struct stat st      = {};
+    FileHeader  header;
+
+    do {
+        if (::fstat(fd, &st) != 0) {
+            break;
+        }
+
+        constexpr auto first = static_cast<off_t>(sizeof(FileHeader));
+        std::size_t    count = 0;
+        if (st.st_size < first) {
+            if (!writeAll(fd, &header, sizeof(header), 0)) {
+                break;
+            }
+        } else {
+            if (::pread(fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))
+                || !validHeader(header)) {
+                std::cerr << "Archive error: " << file << " is not an archive file" << std::endl;
+                break;
+            }
+            // Ignore a torn trailing record from an interrupted append
+            count = static_cast<std::size_t>(st.st_size - first) / sizeof(ArchiveRecord);
+        }
+
+        std::vector<ArchiveRecord> archived(count);
+        const auto                 bytes = static_cast<ssize_t>(count * sizeof(ArchiveRecord));
+        if (count > 0 && ::pread(fd, archived.data(), static_cast<std::size_t>(bytes), first) != bytes) {
+            break;
+        }
+
+        // Merge by day; a fetched record replaces the archived one of its day
+        std::vector<ArchiveRecord> merged;
+        merged.reserve(count + records.size());
+        std::size_t i = 0;
+        for (const auto& r : records) {
+            while (i < archived.size() && archived[i].day < r.day) {
+                merged.push_back(archived[i++]);
+            }
+            if (!merged.empty() && merged.back().day == r.day) {
+                merged.back() = r;  // repeated day within `records`: the later one wins
+                continue;
+            }
+            if (i < archived.size() && archived[i].day == r.day) {
+                changed += std::memcmp(&archived[i], &r, sizeof(r)) != 0;
+                ++i;
+            } else {
+                ++changed;
+            }
+            merged.push_back(r);
+        }
+        merged.insert(merged.end(), archived.begin() + static_cast<std::ptrdiff_t>(i), archived.end());
+
+        // Rewrite from the first record that differs: usually just the appended days and a revised last one
+        std::size_t from = 0;
+        while (from < archived.size() && std::memcmp(&archived[from], &merged[from], sizeof(ArchiveRecord)) == 0) {
+            ++from;
+        }
+        const auto offset = first + static_cast<off_t>(from * sizeof(ArchiveRecord));
+        if (from < merged.size()
+            && !writeAll(fd, merged.data() + from, (merged.size() - from) * sizeof(ArchiveRecord), offset)) {
+            changed = 0;
+            break;
+        }
+        const auto size = first + static_cast<off_t>(merged.size() * sizeof(ArchiveRecord));
+        if (st.st_size > size && ::ftruncate(fd, size) != 0) {
+            break;
+        }
+
+        // Record how far back the merged fetches reach (and upgrade a version 1 header)
+        FileHeader updated;
+        updated.fetchedFrom = std::min(storedFrom(header), fetchStart);
+        if (std::memcmp(&updated, &header, sizeof(header)) != 0 && !writeAll(fd, &updated, sizeof(updated), 0)) {
+            break;
+        }
+
+        // The modification time records the last merge, even when nothing changed
+        ::futimens(fd, nullptr);
+    } while (false);
+
+    ::flock(fd, LOCK_UN);
+    ::close(fd);
+    return changed;
+}
+
+std::size_t SeriesArchive::append(const FredSeriesInfo& series, const std::string& frequency) const {
+    return merge(fredId(series.seriesId, frequency), fredRecords(series), kNoFetch);
+}
+
+std::size_t SeriesArchive::append(const FearAndGreedInfo& fng) const {
+    std::vector<ArchiveRecord> records;
+    records.reserve(fng.days.size());
+
+    const auto n = std::min({fng.days.size(), fng.scores.size(), fng.ratings.size()});
+    for (std::size_t i = 0; i < n; ++i) {
+        ArchiveRecord r;
+        r.day   = fng.days[i];
+        r.tag   = static_cast<uint8_t>(fng.ratings[i]);
+        r.value = fng.scores[i];
+        records.push_back(r);
+    }
+
+    return append(kFearAndGreedId, records);
+}
+
+MappedSeries SeriesArchive::open(const std::string& seriesId) const {
+    MappedSeries view;
+
+    const int fd = ::open(path(seriesId).c_str(), O_RDONLY);
+    if (fd < 0) {
+        return view;
+    }
+
+    // Held until the view is destroyed, so a merge never rewrites records under it
+    ::flock(fd, LOCK_SH);
+    view.fd_ = fd;
+
+    struct stat st = {};
+    if (::fstat(fd, &st) == 0 && st.st_size > static_cast<off_t>(sizeof(FileHeader))) {
+        const auto length = static_cast<std::size_t>(st.st_size);
+        void*      base   = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+        if (base != MAP_FAILED) {
+            view.base_   = base;
+            view.length_ = length;
+            if (validHeader(*static_cast<const FileHeader*>(base))) {
+                view.records_ = reinterpret_cast<const ArchiveRecord*>(static_cast<const char*>(base)
+                                                                       + sizeof(FileHeader));
+                view.size_    = (length - sizeof(FileHeader)) / sizeof(ArchiveRecord);
+            }
+        }
+    }
+
+    return view;
+}
+
+int32_t SeriesArchive::fetchedFrom(const std::string& seriesId) const {
+    const int fd = ::open(path(seriesId).c_str(), O_RDONLY);
+    if (fd < 0) {
+        return kNoFetch;
+    }
+
+    ::flock(fd, LOCK_SH);
+    FileHeader header;
+    const bool read = ::pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header));
+    ::flock(fd, LOCK_UN);
+    ::close(fd);
+
+    return read && validHeader(header) ? storedFrom(header) : kNoFetch;
+}
+
+bool SeriesArchive::load(const std::string& seriesId, FredSeriesInfo& out, const std::string& frequency) const {
+    const auto view = open(fredId(seriesId, frequency));
+    if (view.empty()) {
+        return false;
+    }
+
+    out.seriesId = seriesId;
+    out.dates.resize(view.size());
+    out.values.resize(view.size());
+
+    char buf[10];
+    for (std::size_t i = 0; i < view.size(); ++i) {
+        civil::formatDays(view[i].day, buf);
+        out.dates[i].assign(buf, sizeof(buf));
+        out.values[i] = view[i].value;
+    }
+    return true;
+}
+
+bool SeriesArchive::load(FearAndGreedInfo& out) const {
+    const auto view = open(kFearAndGreedId);
+    if (view.empty()) {
+        return false;
+    }
+
+    out.days.resize(view.size());
+    out.scores.resize(view.size());
+    out.ratings.resize(view.size());
+
+    for (std::size_t i = 0; i < view.size(); ++i) {
+        out.days[i]    = view[i].day;
+        out.scores[i]  = view[i].value;
+        out.ratings[i] = static_cast<FngRating>(view[i].tag);
+    }
+    return true;
+}
+
+std::shared_ptr<FredSeriesInfo> SeriesArchive::fredSeries(const std::string& seriesId,
+                                                          const std::string& frequency,
+                                                          const std::string& start,
+                                                          const std::string& end,
+                                                          int64_t            maxAgeSeconds,
+                                                          const FredFetch&   fetch) const {
+    auto out = std::make_shared<FredSeriesInfo>();
+
+    // Unparsable start dates are requested like unbounded ones
+    const auto id   = fredId(seriesId, frequency);
+    int64_t    day  = 0;
+    const auto from = !start.empty() && civil::parseDate(start, day) ? static_cast<int32_t>(day) : kFromBeginning;
+
+    // Served from the archive if it was merged recently from a fetch reaching back to `start`; the
+    // series itself may begin later
+    struct stat st    = {};
+    bool        fresh = ::stat(path(id).c_str(), &st) == 0 && ::time(nullptr) - st.st_mtime < maxAgeSeconds
+                && fetchedFrom(id) <= from && load(seriesId, *out, frequency) && !out->dates.empty();
+
+    if (!fresh) {
+        const auto fetched = fetch ? fetch() : nullptr;
+        if (fetched && !fetched->values.empty()) {
+            merge(id, fredRecords(*fetched), from);
+        } else {
+            std::cerr << "Archive: fetching " << seriesId << " failed, using the archived history" << std::endl;
+        }
+        if (!load(seriesId, *out, frequency)) {
+            return nullptr;
+        }
+    }
+
+    // Same window as a direct fetch of [start, end]
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < out->dates.size(); ++i) {
+        if ((start.empty() || out->dates[i] >= start) && (end.empty() || out->dates[i] <= end)) {
+            out->dates[kept]  = std::move(out->dates[i]);
+            out->values[kept] = out->values[i];
+            ++kept;
+        }
+    }
+    out->dates.resize(kept);
+    out->values.resize(kept);
+    return kept > 0 ? out : nullptr;
+}
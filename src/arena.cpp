@@ -0,0 +1,33 @@
+#include "arena.hpp"
+
+#include <algorithm>
+
+namespace {
+
+thread_local std::pmr::memory_resource* currentResource = nullptr;
+
+}  // namespace
+
+ParseArena::ParseArena(std::size_t initialSize, std::pmr::memory_resource* upstream)
+    : upstream_(upstream ? upstream : ArenaScope::current())
+    , initialSize_(std::max<std::size_t>(initialSize, 1))
+    , initial_(upstream_->allocate(initialSize_))
+    , resource_(initial_, initialSize_, upstream_) {}
+
+ParseArena::~ParseArena() {
+    resource_.release();
+    upstream_->deallocate(initial_, initialSize_);
+}
+
+ArenaScope::ArenaScope(ParseArena& arena)
+    : previous_(currentResource) {
+    currentResource = arena.resource();
+}
+
+ArenaScope::~ArenaScope() {
+    currentResource = previous_;
+}
+
+std::pmr::memory_resource* ArenaScope::current() {
+    return currentResource ? currentResource : std::pmr::get_default_resource();
+}
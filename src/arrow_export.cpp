@@ -0,0 +1,271 @@
+#include "arrow_export.hpp"
+
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+/* Everything one exported batch keeps alive: the source object and any transposed columns */
+struct Holder {
+    std::shared_ptr<const void>              owner;
+    std::vector<std::shared_ptr<const void>> storage;
+
+    /* Build an owned column of n values of T from get(i) */
+    template <typename T, typename Get>
+    const void* column(std::size_t n, Get get) {
+        auto values = std::make_shared<std::vector<T>>(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            (*values)[i] = get(i);
+        }
+        storage.push_back(values);
+        return values->data();
+    }
+
+    /* Build an owned validity-style bitmap (LSB first) of n bools from get(i) */
+    template <typename Get>
+    const void* bitmap(std::size_t n, Get get) {
+        auto bits = std::make_shared<std::vector<uint8_t>>((n + 7) / 8, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            (*bits)[i / 8] |= static_cast<uint8_t>(get(i) ? (1u << (i % 8)) : 0u);
+        }
+        storage.push_back(bits);
+        return bits->data();
+    }
+
+    /* Build owned utf8 offsets and data buffers from get(i) */
+    template <typename Get>
+    std::pair<const void*, const void*> strings(std::size_t n, Get get) {
+        auto offsets = std::make_shared<std::vector<int32_t>>(n + 1, 0);
+        auto chars   = std::make_shared<std::vector<char>>();
+        for (std::size_t i = 0; i < n; ++i) {
+            const std::string s = get(i);
+            chars->insert(chars->end(), s.begin(), s.end());
+            (*offsets)[i + 1] = static_cast<int32_t>(chars->size());
+        }
+        storage.push_back(offsets);
+        storage.push_back(chars);
+        return {offsets->data(), chars->data()};
+    }
+};
+
+struct Column {
+    const char*              format;
+    const char*              name;
+    std::vector<const void*> buffers;  // validity bitmap first (always null here)
+};
+
+/* private_data of every exported ArrowArray */
+struct ArrayPrivate {
+    std::shared_ptr<Holder>  holder;
+    std::vector<const void*> buffers;
+    std::vector<ArrowArray>  childArrays;
+    std::vector<ArrowArray*> children;
+};
+
+/* private_data of every exported ArrowSchema */
+struct SchemaPrivate {
+    std::string               metadata;
+    std::vector<ArrowSchema>  childSchemas;
+    std::vector<ArrowSchema*> children;
+};
+
+void releaseArray(ArrowArray* array) {
+    auto* priv = static_cast<ArrayPrivate*>(array->private_data);
+    for (auto* child : priv->children) {
+        // Children the consumer moved out have release == nullptr here
+        if (child->release) {
+            child->release(child);
+        }
+    }
+    delete priv;
+    array->release = nullptr;
+}
+
+void releaseSchema(ArrowSchema* schema) {
+    auto* priv = static_cast<SchemaPrivate*>(schema->private_data);
+    for (auto* child : priv->children) {
+        if (child->release) {
+            child->release(child);
+        }
+    }
+    delete priv;
+    schema->release = nullptr;
+}
+
+void initArray(ArrowArray* array, ArrayPrivate* priv, int64_t length) {
+    array->length       = length;
+    array->null_count   = 0;
+    array->offset       = 0;
+    array->n_buffers    = static_cast<int64_t>(priv->buffers.size());
+    array->n_children   = static_cast<int64_t>(priv->children.size());
+    array->buffers      = priv->buffers.data();
+    array->children     = priv->children.empty() ? nullptr : priv->children.data();
+    array->dictionary   = nullptr;
+    array->release      = &releaseArray;
+    array->private_data = priv;
+}
+
+void initSchema(ArrowSchema* schema, SchemaPrivate* priv, const char* format, const char* name) {
+    schema->format       = format;
+    schema->name         = name;
+    schema->metadata     = priv->metadata.empty() ? nullptr : priv->metadata.data();
+    schema->flags        = 0;
+    schema->n_children   = static_cast<int64_t>(priv->children.size());
+    schema->children     = priv->children.empty() ? nullptr : priv->children.data();
+    schema->dictionary   = nullptr;
+    schema->release      = &releaseSchema;
+    schema->private_data = priv;
+}
+
+/* Encode key/value pairs in the C Data Interface metadata layout */
+std::string encodeMetadata(const std::vector<std::pair<std::string, std::string>>& pairs) {
+    std::string out;
+    auto        put = [&out](int32_t n) {
+        out.append(reinterpret_cast<const char*>(&n), sizeof(n));
+    };
+    put(static_cast<int32_t>(pairs.size()));
+    for (const auto& [key, value] : pairs) {
+        put(static_cast<int32_t>(key.size()));
+        out += key;
+        put(static_cast<int32_t>(value.size()));
+        out += value;
+    }
+    return out;
+}
+
+/* Export columns of equal length as a non-nullable struct array */
+void exportStruct(const std::shared_ptr<Holder>& holder, int64_t length, const std::vector<Column>& columns,
+                  std::string metadata, ArrowSchema* schema, ArrowArray* array) {
+    auto* arrayPriv  = new ArrayPrivate;
+    auto* schemaPriv = new SchemaPrivate;
+
+    arrayPriv->holder  = holder;
+    arrayPriv->buffers = {nullptr};
+    arrayPriv->childArrays.resize(columns.size());
+    schemaPriv->metadata = std::move(metadata);
+    schemaPriv->childSchemas.resize(columns.size());
+
+    for (std::size_t i = 0; i < columns.size(); ++i) {
+        auto* childArray    = new ArrayPrivate;
+        childArray->holder  = holder;
+        childArray->buffers = columns[i].buffers;
+        initArray(&arrayPriv->childArrays[i], childArray, length);
+        arrayPriv->children.push_back(&arrayPriv->childArrays[i]);
+
+        initSchema(&schemaPriv->childSchemas[i], new SchemaPrivate, columns[i].format, columns[i].name);
+        schemaPriv->children.push_back(&schemaPriv->childSchemas[i]);
+    }
+
+    initArray(array, arrayPriv, length);
+    initSchema(schema, schemaPriv, "+s", "");
+}
+
+}  // namespace
+
+bool ArrowExport::exportStockInfo(const std::shared_ptr<const StockInfo>& data, ArrowSchema* schema,
+                                  ArrowArray* array) {
+    if (!data || !schema || !array) {
+        return false;
+    }
+
+    const auto n = data->timestamps.size();
+    if (data->open.size() != n || data->high.size() != n || data->low.size() != n || data->close.size() != n
+        || data->volume.size() != n) {
+        std::cerr << "Arrow export error: " << data->ticker << " columns differ in length" << std::endl;
+        return false;
+    }
+
+    auto holder   = std::make_shared<Holder>();
+    holder->owner = data;
+
+    // clang-format off
+    const std::vector<Column> columns = {
+        {"tss:UTC", "timestamps", {nullptr, data->timestamps.data()}},
+        {"g",       "open",       {nullptr, data->open.data()}},
+        {"g",       "high",       {nullptr, data->high.data()}},
+        {"g",       "low",        {nullptr, data->low.data()}},
+        {"g",       "close",      {nullptr, data->close.data()}},
+        {"l",       "volume",     {nullptr, data->volume.data()}},
+    };
+    // clang-format on
+
+    exportStruct(holder, static_cast<int64_t>(n), columns, encodeMetadata({{"ticker", data->ticker}}), schema,
+                 array);
+    return true;
+}
+
+bool ArrowExport::exportTrades(const std::shared_ptr<const BacktestResult>& result, ArrowSchema* schema,
+                               ArrowArray* array) {
+    if (!result || !schema || !array) {
+        return false;
+    }
+
+    const auto& trades = result->trades;
+    const auto  n      = trades.size();
+
+    auto holder   = std::make_shared<Holder>();
+    holder->owner = result;
+
+    // clang-format off
+    const std::vector<Column> columns = {
+        {"L", "buyIndex",  {nullptr, holder->column<uint64_t>(n, [&](std::size_t i) { return trades[i].buyIndex; })}},
+        {"L", "sellIndex", {nullptr, holder->column<uint64_t>(n, [&](std::size_t i) { return trades[i].sellIndex; })}},
+        {"g", "buyPrice",  {nullptr, holder->column<double>(n, [&](std::size_t i) { return trades[i].buyPrice; })}},
+        {"g", "sellPrice", {nullptr, holder->column<double>(n, [&](std::size_t i) { return trades[i].sellPrice; })}},
+        {"g", "returnPct", {nullptr, holder->column<double>(n, [&](std::size_t i) { return trades[i].returnPct; })}},
+    };
+    // clang-format on
+
+    exportStruct(holder, static_cast<int64_t>(n), columns, encodeMetadata({{"ticker", result->ticker}}), schema,
+                 array);
+    return true;
+}
+
+bool ArrowExport::exportPeriods(const std::shared_ptr<const MacroBacktestResult>& result, ArrowSchema* schema,
+                                ArrowArray* array) {
+    if (!result || !schema || !array) {
+        return false;
+    }
+
+    const auto& p = result->periods;
+    const auto  n = p.size();
+
+    auto holder   = std::make_shared<Holder>();
+    holder->owner = result;
+
+    auto f64 = [&](auto get) {
+        return holder->column<double>(n, get);
+    };
+
+    const auto date   = holder->strings(n, [&](std::size_t i) { return p[i].date; });
+    const auto regime = holder->strings(n, [&](std::size_t i) { return MacroScorer::regimeToString(p[i].regime); });
+    const auto prev = holder->strings(n, [&](std::size_t i) { return MacroScorer::regimeToString(p[i].prevRegime); });
+
+    // clang-format off
+    const std::vector<Column> columns = {
+        {"u", "date",         {nullptr, date.first, date.second}},
+        {"u", "regime",       {nullptr, regime.first, regime.second}},
+        {"u", "prevRegime",   {nullptr, prev.first, prev.second}},
+        {"g", "growth",       {nullptr, f64([&](std::size_t i) { return p[i].scores.growth; })}},
+        {"g", "inflation",    {nullptr, f64([&](std::size_t i) { return p[i].scores.inflation; })}},
+        {"g", "liquidity",    {nullptr, f64([&](std::size_t i) { return p[i].scores.liquidity; })}},
+        {"g", "sentiment",    {nullptr, f64([&](std::size_t i) { return p[i].scores.sentiment; })}},
+        {"g", "risk",         {nullptr, f64([&](std::size_t i) { return p[i].scores.risk; })}},
+        {"g", "composite",    {nullptr, f64([&](std::size_t i) { return p[i].scores.composite; })}},
+        {"g", "stocks",       {nullptr, f64([&](std::size_t i) { return p[i].alloc.stocks; })}},
+        {"g", "gold",         {nullptr, f64([&](std::size_t i) { return p[i].alloc.gold; })}},
+        {"g", "metals",       {nullptr, f64([&](std::size_t i) { return p[i].alloc.metals; })}},
+        {"g", "bonds",        {nullptr, f64([&](std::size_t i) { return p[i].alloc.bonds; })}},
+        {"g", "cash",         {nullptr, f64([&](std::size_t i) { return p[i].alloc.cash; })}},
+        {"b", "allocChanged", {nullptr, holder->bitmap(n, [&](std::size_t i) { return p[i].allocChanged; })}},
+        {"g", "equity",       {nullptr, f64([&](std::size_t i) { return p[i].equity; })}},
+        {"g", "monthReturn",  {nullptr, f64([&](std::size_t i) { return p[i].monthReturn; })}},
+    };
+    // clang-format on
+
+    exportStruct(holder, static_cast<int64_t>(n), columns, encodeMetadata({{"frequency", result->frequency}}),
+                 schema, array);
+    return true;
+}
@@ -4,6 +4,8 @@
 #include <cmath>
 #include <numeric>
 
+#include "indicator/drawdown.hpp"
+
 BacktestEngine::BacktestEngine(double initialCapital)
     : initialCapital_(initialCapital) {}
 
@@ -36,7 +38,13 @@ BacktestResult BacktestEngine::run(IStrategy& strategy, const StockInfo& data) {
     equity.reserve(n);
 
     for (std::size_t i = 0; i < n; ++i) {
-        const double price         = data.close[i];
+        const double price = data.close[i];
+        if (std::isnan(price)) {
+            // Missing bar: nothing to trade at, so hold the last valid equity
+            equity.push_back(equity.empty() ? capital : equity.back());
+            continue;
+        }
+
         const double currentEquity = inPos ? (shares * price) : capital;
         equity.push_back(currentEquity);
 
@@ -71,14 +79,18 @@ BacktestResult BacktestEngine::run(IStrategy& strategy, const StockInfo& data) {
         }
     }
 
-    // If still in position at the end, close at last price
-    if (inPos && !data.close.empty()) {
-        const double lastPrice = data.close.back();
+    // If still in position at the end, close at the last valid price
+    std::size_t lastIdx = n - 1;
+    while (lastIdx > buyIdx && std::isnan(data.close[lastIdx])) {
+        --lastIdx;
+    }
+    if (inPos) {
+        const double lastPrice = data.close[lastIdx];
         capital                = shares * lastPrice;
 
         Trade trade;
         trade.buyIndex  = buyIdx;
-        trade.sellIndex = n - 1;
+        trade.sellIndex = lastIdx;
         trade.buyPrice  = buyPrice;
         trade.sellPrice = lastPrice;
         trade.returnPct = (lastPrice - buyPrice) / buyPrice * 100.0;
@@ -104,16 +116,7 @@ BacktestResult BacktestEngine::run(IStrategy& strategy, const StockInfo& data) {
     }
 
     // 3. Max Drawdown
-    if (!equity.empty()) {
-        double peak  = equity[0];
-        double maxDD = 0.0;
-        for (const auto& eq : equity) {
-            peak            = std::max(peak, eq);
-            const double dd = (eq - peak) / peak * 100.0;
-            maxDD           = std::min(maxDD, dd);
-        }
-        result.maxDrawdownPct = maxDD;
-    }
+    result.maxDrawdownPct = indicator::maxDrawdownPct(equity);
 
     // 4. Sharpe Ratio (annualized, assuming daily data, risk-free = 0)
     if (equity.size() > 1) {
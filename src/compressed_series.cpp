@@ -0,0 +1,331 @@
+#include "compressed_series.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+/* MSB-first bit stream writer appending to a byte vector */
+class BitWriter {
+   public:
+    explicit BitWriter(std::vector<uint8_t>& out)
+        : out_(out) {}
+
+    void write(uint64_t value, unsigned bits) {
+        if (bits > 32) {
+            write(value >> 32, bits - 32);
+            bits = 32;
+        }
+        const uint64_t mask = (bits == 64) ? ~uint64_t{0} : ((uint64_t{1} << bits) - 1);
+        acc_                = (acc_ << bits) | (value & mask);
+        used_ += bits;
+        while (used_ >= 8) {
+            used_ -= 8;
+            out_.push_back(static_cast<uint8_t>(acc_ >> used_));
+        }
+    }
+
+    void flush() {
+        if (used_ > 0) {
+            out_.push_back(static_cast<uint8_t>(acc_ << (8 - used_)));
+            used_ = 0;
+        }
+        acc_ = 0;
+    }
+
+   private:
+    std::vector<uint8_t>& out_;
+    uint64_t              acc_  = 0;
+    unsigned              used_ = 0;
+};
+
+/* MSB-first bit stream reader. Requires 8 readable padding bytes past the end. */
+class BitReader {
+   public:
+    explicit BitReader(const uint8_t* data)
+        : data_(data) {}
+
+    uint64_t read(unsigned bits) {
+        if (bits > 32) {
+            const uint64_t hi = read(bits - 32);
+            return (hi << 32) | read(32);
+        }
+        if (bits == 0) {
+            return 0;
+        }
+        uint64_t word;
+        std::memcpy(&word, data_ + (pos_ >> 3), sizeof(word));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        word = __builtin_bswap64(word);
+#endif
+        word <<= (pos_ & 7);
+        pos_ += bits;
+        return word >> (64 - bits);
+    }
+
+    bool bit() { return read(1) != 0; }
+
+   private:
+    const uint8_t* data_;
+    std::size_t    pos_ = 0;
+};
+
+inline uint64_t zigzag(int64_t v) {
+    return (static_cast<uint64_t>(v) << 1) ^ static_cast<uint64_t>(v >> 63);
+}
+
+inline int64_t unzigzag(uint64_t v) {
+    return static_cast<int64_t>(v >> 1) ^ -static_cast<int64_t>(v & 1);
+}
+
+inline uint64_t toBits(double v) {
+    uint64_t bits;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+inline double fromBits(uint64_t bits) {
+    double v;
+    std::memcpy(&v, &bits, sizeof(v));
+    return v;
+}
+
+/* ---- Timestamps: delta-of-delta ---- */
+
+void encodeTimestamps(BitWriter& w, const int64_t* ts, std::size_t n) {
+    w.write(static_cast<uint64_t>(ts[0]), 64);
+    int64_t prevDelta = 0;
+    for (std::size_t i = 1; i < n; ++i) {
+        const int64_t  delta = ts[i] - ts[i - 1];
+        const uint64_t z     = zigzag(delta - prevDelta);
+        prevDelta            = delta;
+
+        if (z == 0) {
+            w.write(0b0, 1);
+        } else if (z < (uint64_t{1} << 7)) {
+            w.write(0b10, 2);
+            w.write(z, 7);
+        } else if (z < (uint64_t{1} << 9)) {
+            w.write(0b110, 3);
+            w.write(z, 9);
+        } else if (z < (uint64_t{1} << 12)) {
+            w.write(0b1110, 4);
+            w.write(z, 12);
+        } else if (z < (uint64_t{1} << 32)) {
+            w.write(0b11110, 5);
+            w.write(z, 32);
+        } else {
+            w.write(0b11111, 5);
+            w.write(z, 64);
+        }
+    }
+}
+
+void decodeTimestamps(BitReader& r, int64_t* ts, std::size_t n) {
+    ts[0]             = static_cast<int64_t>(r.read(64));
+    int64_t prevDelta = 0;
+    for (std::size_t i = 1; i < n; ++i) {
+        uint64_t z = 0;
+        if (r.bit()) {
+            if (!r.bit()) {
+                z = r.read(7);
+            } else if (!r.bit()) {
+                z = r.read(9);
+            } else if (!r.bit()) {
+                z = r.read(12);
+            } else if (!r.bit()) {
+                z = r.read(32);
+            } else {
+                z = r.read(64);
+            }
+        }
+        prevDelta += unzigzag(z);
+        ts[i] = ts[i - 1] + prevDelta;
+    }
+}
+
+/* ---- Doubles: Gorilla XOR ---- */
+
+void encodeDoubles(BitWriter& w, const double* values, std::size_t n) {
+    uint64_t prev = toBits(values[0]);
+    w.write(prev, 64);
+
+    unsigned prevLead  = 0;
+    unsigned prevTrail = 0;
+    bool     hasWindow = false;
+
+    for (std::size_t i = 1; i < n; ++i) {
+        const uint64_t cur = toBits(values[i]);
+        const uint64_t x   = cur ^ prev;
+        prev               = cur;
+
+        if (x == 0) {
+            w.write(0b0, 1);
+            continue;
+        }
+        w.write(0b1, 1);
+
+        const unsigned lead  = std::min(static_cast<unsigned>(__builtin_clzll(x)), 31U);
+        const unsigned trail = static_cast<unsigned>(__builtin_ctzll(x));
+
+        if (hasWindow && lead >= prevLead && trail >= prevTrail) {
+            // Meaningful bits fit in the previous window
+            w.write(0b0, 1);
+            w.write(x >> prevTrail, 64 - prevLead - prevTrail);
+        } else {
+            const unsigned len = 64 - lead - trail;
+            w.write(0b1, 1);
+            w.write(lead, 5);
+            w.write(len - 1, 6);
+            w.write(x >> trail, len);
+            prevLead  = lead;
+            prevTrail = trail;
+            hasWindow = true;
+        }
+    }
+}
+
+void decodeDoubles(BitReader& r, double* values, std::size_t n) {
+    uint64_t prev = r.read(64);
+    values[0]     = fromBits(prev);
+
+    unsigned prevLead  = 0;
+    unsigned prevTrail = 0;
+
+    for (std::size_t i = 1; i < n; ++i) {
+        if (r.bit()) {
+            if (r.bit()) {
+                prevLead            = static_cast<unsigned>(r.read(5));
+                const unsigned len  = static_cast<unsigned>(r.read(6)) + 1;
+                prevTrail           = 64 - prevLead - len;
+                prev               ^= r.read(len) << prevTrail;
+            } else {
+                prev ^= r.read(64 - prevLead - prevTrail) << prevTrail;
+            }
+        }
+        values[i] = fromBits(prev);
+    }
+}
+
+/* ---- Volumes: varint ---- */
+
+void encodeVarints(BitWriter& w, const int64_t* values, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        uint64_t z = zigzag(values[i]);
+        while (z >= 0x80) {
+            w.write((z & 0x7F) | 0x80, 8);
+            z >>= 7;
+        }
+        w.write(z, 8);
+    }
+}
+
+void decodeVarints(BitReader& r, int64_t* values, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        uint64_t z     = 0;
+        unsigned shift = 0;
+        uint64_t byte  = 0;
+        do {
+            byte = r.read(8);
+            z |= (byte & 0x7F) << shift;
+            shift += 7;
+        } while ((byte & 0x80) != 0 && shift < 64);
+        values[i] = unzigzag(z);
+    }
+}
+
+/* Copy a possibly-short column into a block-sized buffer, padding with zero */
+template <typename T>
+const T* blockColumn(const std::vector<T>& column, std::size_t begin, std::size_t count, std::vector<T>& pad) {
+    if (begin + count <= column.size()) {
+        return column.data() + begin;
+    }
+    pad.assign(count, T{});
+    if (begin < column.size()) {
+        std::copy(column.begin() + static_cast<long>(begin), column.end(), pad.begin());
+    }
+    return pad.data();
+}
+
+}  // namespace
+
+CompressedSeries CompressedSeries::encode(const StockInfo& data, std::size_t blockSize) {
+    CompressedSeries series;
+    series.ticker_    = data.ticker;
+    series.size_      = data.timestamps.size();
+    series.blockSize_ = std::max<std::size_t>(blockSize, 1);
+
+    BitWriter            writer(series.bytes_);
+    std::vector<double>  padDouble;
+    std::vector<int64_t> padInt;
+
+    for (std::size_t begin = 0; begin < series.size_; begin += series.blockSize_) {
+        const std::size_t count = std::min(series.blockSize_, series.size_ - begin);
+        series.blocks_.push_back({series.bytes_.size(), static_cast<uint32_t>(count)});
+
+        encodeTimestamps(writer, data.timestamps.data() + begin, count);
+        encodeDoubles(writer, blockColumn(data.open, begin, count, padDouble), count);
+        encodeDoubles(writer, blockColumn(data.high, begin, count, padDouble), count);
+        encodeDoubles(writer, blockColumn(data.low, begin, count, padDouble), count);
+        encodeDoubles(writer, blockColumn(data.close, begin, count, padDouble), count);
+        encodeVarints(writer, blockColumn(data.volume, begin, count, padInt), count);
+
+        // Blocks start byte-aligned so each can be decoded independently
+        writer.flush();
+    }
+
+    // Padding for the reader's 8-byte loads
+    series.bytes_.insert(series.bytes_.end(), 8, 0);
+    series.bytes_.shrink_to_fit();
+    return series;
+}
+
+void CompressedSeries::decodeBlock(std::size_t block, StockInfo& scratch) const {
+    const auto& index = blocks_[block];
+    const auto  n     = static_cast<std::size_t>(index.count);
+
+    scratch.touch();
+    scratch.timestamps.resize(n);
+    scratch.open.resize(n);
+    scratch.high.resize(n);
+    scratch.low.resize(n);
+    scratch.close.resize(n);
+    scratch.volume.resize(n);
+
+    BitReader reader(bytes_.data() + index.offset);
+    decodeTimestamps(reader, scratch.timestamps.data(), n);
+    decodeDoubles(reader, scratch.open.data(), n);
+    decodeDoubles(reader, scratch.high.data(), n);
+    decodeDoubles(reader, scratch.low.data(), n);
+    decodeDoubles(reader, scratch.close.data(), n);
+    decodeVarints(reader, scratch.volume.data(), n);
+}
+
+void CompressedSeries::decode(StockInfo& out) const {
+    out.touch();
+    out.ticker = ticker_;
+    out.timestamps.clear();
+    out.open.clear();
+    out.high.clear();
+    out.low.clear();
+    out.close.clear();
+    out.volume.clear();
+
+    out.timestamps.reserve(size_);
+    out.open.reserve(size_);
+    out.high.reserve(size_);
+    out.low.reserve(size_);
+    out.close.reserve(size_);
+    out.volume.reserve(size_);
+
+    StockInfo scratch;
+    for (std::size_t b = 0; b < blocks_.size(); ++b) {
+        decodeBlock(b, scratch);
+        out.timestamps.insert(out.timestamps.end(), scratch.timestamps.begin(), scratch.timestamps.end());
+        out.open.insert(out.open.end(), scratch.open.begin(), scratch.open.end());
+        out.high.insert(out.high.end(), scratch.high.begin(), scratch.high.end());
+        out.low.insert(out.low.end(), scratch.low.begin(), scratch.low.end());
+        out.close.insert(out.close.end(), scratch.close.begin(), scratch.close.end());
+        out.volume.insert(out.volume.end(), scratch.volume.begin(), scratch.volume.end());
+    }
+}
@@ -0,0 +1,491 @@
+#include "csv_reader.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <numeric>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "civil_date.hpp"
+
+namespace {
+
+/* Target bits of a CSV field; one field may feed several columns */
+enum : uint8_t
+{
+    kDate   = 1 << 0,
+    kOpen   = 1 << 1,
+    kHigh   = 1 << 2,
+    kLow    = 1 << 3,
+    kClose  = 1 << 4,
+    kVolume = 1 << 5,
+};
+
+constexpr std::size_t kBlock = 64;
+
+/* Bit i set if p[i] is the delimiter or a newline, for the 64 bytes at p */
+inline uint64_t structuralMask(const char* p, char delimiter) {
+#if defined(__SSE2__)
+    const __m128i delim   = _mm_set1_epi8(delimiter);
+    const __m128i newline = _mm_set1_epi8('\n');
+    uint64_t      mask    = 0;
+    for (std::size_t i = 0; i < kBlock / 16; ++i) {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i * 16));
+        const __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, delim), _mm_cmpeq_epi8(v, newline));
+        mask |= static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(m))) << (i * 16);
+    }
+    return mask;
+#else
+    uint64_t mask = 0;
+    for (std::size_t i = 0; i < kBlock; ++i) {
+        mask |= static_cast<uint64_t>(p[i] == delimiter || p[i] == '\n') << i;
+    }
+    return mask;
+#endif
+}
+
+/* Yields the positions of delimiters and newlines in order, one 64-byte block mask at a time */
+class StructuralScanner {
+   public:
+    StructuralScanner(const char* data, std::size_t size, char delimiter)
+        : data_(data)
+        , size_(size)
+        , delimiter_(delimiter) {
+        load();
+    }
+
+    /**
+     * @brief Position of the next delimiter or newline, or size if there is none.
+     */
+    std::size_t next() {
+        while (mask_ == 0) {
+            block_ += kBlock;
+            if (block_ >= size_) {
+                return size_;
+            }
+            load();
+        }
+        const auto pos = block_ + static_cast<std::size_t>(__builtin_ctzll(mask_));
+        mask_ &= mask_ - 1;
+        return pos;
+    }
+
+   private:
+    void load() {
+        if (block_ + kBlock <= size_) {
+            mask_ = structuralMask(data_ + block_, delimiter_);
+            return;
+        }
+        mask_ = 0;
+        for (std::size_t i = 0; block_ + i < size_; ++i) {
+            const char c = data_[block_ + i];
+            mask_ |= static_cast<uint64_t>(c == delimiter_ || c == '\n') << i;
+        }
+    }
+
+    const char* data_;
+    std::size_t size_;
+    char        delimiter_;
+    std::size_t block_ = 0;
+    uint64_t    mask_  = 0;
+};
+
+/* Strip '\r', surrounding blanks and quotes from a raw field */
+inline std::string_view trimField(const char* first, const char* last) {
+    while (last > first && (last[-1] == '\r' || last[-1] == ' ')) {
+        --last;
+    }
+    while (first < last && *first == ' ') {
+        ++first;
+    }
+    if (last - first >= 2 && *first == '"' && last[-1] == '"') {
+        ++first;
+        --last;
+    }
+    return std::string_view(first, static_cast<std::size_t>(last - first));
+}
+
+/*
+ * Plain "[-]digits[.digits]" with at most 2^53 as the integer mantissa and at most
+ * 22 fraction digits: both operands are exact doubles, so one correctly rounded
+ * division gives the same bits as a full parse (Clinger's fast path).
+ */
+inline bool parseDecimalFast(std::string_view s, double& out) {
+    static constexpr double kPow10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+    const char* p   = s.data();
+    const char* end = p + s.size();
+
+    const bool negative = (p < end && *p == '-');
+    p += negative;
+
+    uint64_t mantissa = 0;
+    int      digits   = 0;
+    int      fraction = 0;
+    for (; p < end && static_cast<unsigned>(*p - '0') <= 9 && digits < 19; ++p, ++digits) {
+        mantissa = mantissa * 10 + static_cast<unsigned>(*p - '0');
+    }
+    if (p < end && *p == '.') {
+        ++p;
+        for (; p < end && static_cast<unsigned>(*p - '0') <= 9 && digits < 19; ++p, ++digits, ++fraction) {
+            mantissa = mantissa * 10 + static_cast<unsigned>(*p - '0');
+        }
+    }
+
+    if (p != end || digits == 0 || mantissa > (uint64_t(1) << 53) || fraction > 22) {
+        return false;
+    }
+
+    const double value = static_cast<double>(mantissa) / kPow10[fraction];
+    out                = negative ? -value : value;
+    return true;
+}
+
+inline bool parseDouble(std::string_view s, double& out) {
+    if (parseDecimalFast(s, out)) {
+        return true;
+    }
+#if defined(__cpp_lib_to_chars)
+    const auto [p, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+    return ec == std::errc() && p == s.data() + s.size();
+#else
+    char buf[64];
+    if (s.empty() || s.size() >= sizeof(buf)) {
+        return false;
+    }
+    std::memcpy(buf, s.data(), s.size());
+    buf[s.size()] = '\0';
+    char* end     = nullptr;
+    out           = std::strtod(buf, &end);
+    return end == buf + s.size();
+#endif
+}
+
+inline bool parseVolume(std::string_view s, int64_t& out) {
+    const auto [p, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+    if (ec == std::errc() && p == s.data() + s.size()) {
+        return true;
+    }
+    // Some vendors write volume as "12345.0"
+    double value = 0.0;
+    if (parseDouble(s, value)) {
+        out = static_cast<int64_t>(value);
+        return true;
+    }
+    return false;
+}
+
+inline bool digits2(const char* p, unsigned& out) {
+    const auto hi = static_cast<unsigned>(p[0] - '0');
+    const auto lo = static_cast<unsigned>(p[1] - '0');
+    out           = hi * 10 + lo;
+    return hi <= 9 && lo <= 9;
+}
+
+/* "YYYY-MM-DD", "YYYY-MM-DD[ T]HH:MM[:SS]" (UTC) or integer Unix seconds */
+inline bool parseTimestamp(std::string_view s, int64_t& out) {
+    if (s.size() >= 10 && s[4] == '-') {
+        int64_t days = 0;
+        if (!civil::parseDatePrefix(s, days)) {
+            return false;
+        }
+        int64_t seconds = 0;
+        if (s.size() >= 16 && (s[10] == ' ' || s[10] == 'T') && s[13] == ':') {
+            unsigned hh = 0;
+            unsigned mm = 0;
+            unsigned ss = 0;
+            if (!digits2(s.data() + 11, hh) || !digits2(s.data() + 14, mm)) {
+                return false;
+            }
+            if (s.size() >= 19 && s[16] == ':' && !digits2(s.data() + 17, ss)) {
+                return false;
+            }
+            seconds = hh * 3600 + mm * 60 + ss;
+        }
+        out = civil::toTimestamp(days) + seconds;
+        return true;
+    }
+
+    const auto [p, ec] = std::from_chars(s.data(), s.data() + s.size(), out);
+    return ec == std::errc() && p == s.data() + s.size() && !s.empty();
+}
+
+bool equalsIgnoreCase(std::string_view a, std::string_view b) {
+    if (a.size() != b.size()) {
+        return false;
+    }
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        const auto x = static_cast<unsigned char>(a[i]);
+        const auto y = static_cast<unsigned char>(b[i]);
+        if (std::tolower(x) != std::tolower(y)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/* Apply a row permutation to one column */
+template <typename T>
+void permute(std::vector<T>& column, const std::vector<std::size_t>& order) {
+    std::vector<T> sorted(column.size());
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        sorted[i] = column[order[i]];
+    }
+    column.swap(sorted);
+}
+
+void sortByTime(StockInfo& out) {
+    auto& ts = out.timestamps;
+    if (std::is_sorted(ts.begin(), ts.end())) {
+        return;
+    }
+
+    // Vendor files are often newest-first
+    if (std::is_sorted(ts.rbegin(), ts.rend())) {
+        std::reverse(ts.begin(), ts.end());
+        std::reverse(out.open.begin(), out.open.end());
+        std::reverse(out.high.begin(), out.high.end());
+        std::reverse(out.low.begin(), out.low.end());
+        std::reverse(out.close.begin(), out.close.end());
+        std::reverse(out.volume.begin(), out.volume.end());
+        return;
+    }
+
+    std::vector<std::size_t> order(ts.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&ts](std::size_t a, std::size_t b) { return ts[a] < ts[b]; });
+    permute(ts, order);
+    permute(out.open, order);
+    permute(out.high, order);
+    permute(out.low, order);
+    permute(out.close, order);
+    permute(out.volume, order);
+}
+
+/* File name without directory and extension */
+std::string stem(const std::string& path) {
+    const auto slash = path.find_last_of('/');
+    auto       name  = (slash == std::string::npos) ? path : path.substr(slash + 1);
+    const auto dot   = name.find_last_of('.');
+    if (dot != std::string::npos && dot > 0) {
+        name.resize(dot);
+    }
+    return name;
+}
+
+}  // namespace
+
+std::shared_ptr<StockInfo> CsvReader::load(const std::string& path, const CsvOptions& options) {
+    auto out = std::make_shared<StockInfo>();
+    if (!load(path, *out, options)) {
+        return nullptr;
+    }
+    return out;
+}
+
+bool CsvReader::load(const std::string& path, StockInfo& out, const CsvOptions& options) {
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        std::cerr << "CSV error: cannot open " << path << ": " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    struct stat st = {};
+    if (::fstat(fd, &st) != 0) {
+        std::cerr << "CSV error: cannot stat " << path << ": " << std::strerror(errno) << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    const auto length = static_cast<std::size_t>(st.st_size);
+    void*      base   = nullptr;
+    if (length > 0) {
+        base = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (base == MAP_FAILED) {
+            std::cerr << "CSV error: cannot map " << path << ": " << std::strerror(errno) << std::endl;
+            ::close(fd);
+            return false;
+        }
+        ::madvise(base, length, MADV_SEQUENTIAL);
+    }
+    ::close(fd);
+
+    CsvOptions opts = options;
+    if (opts.ticker.empty()) {
+        opts.ticker = stem(path);
+    }
+
+    const bool ok = parse(std::string_view(static_cast<const char*>(base), length), out, opts);
+    if (base) {
+        ::munmap(base, length);
+    }
+    return ok;
+}
+
+bool CsvReader::parse(std::string_view text, StockInfo& out, const CsvOptions& options) {
+    out.touch();
+    const char*       data = text.data();
+    const std::size_t size = text.size();
+
+    StructuralScanner scanner(data, size, options.delimiter);
+    std::size_t       pos = 0;
+
+    // Skip a UTF-8 byte order mark
+    if (size >= 3 && std::memcmp(data, "\xEF\xBB\xBF", 3) == 0) {
+        pos = 3;
+    }
+
+    /* Header */
+    std::vector<std::string_view> header;
+    if (options.hasHeader) {
+        while (pos < size) {
+            const auto end = scanner.next();
+            header.push_back(trimField(data + pos, data + end));
+            pos = end + 1;
+            if (end >= size || data[end] == '\n') {
+                break;
+            }
+        }
+    }
+
+    /* Column mapping */
+    std::vector<uint8_t> targets;
+    uint8_t              mapped = 0;
+
+    auto resolve = [&](const CsvColumn& column, uint8_t bit) {
+        int index = column.index;
+        if (index < 0 && !column.name.empty()) {
+            for (std::size_t i = 0; i < header.size(); ++i) {
+                if (equalsIgnoreCase(header[i], column.name)) {
+                    index = static_cast<int>(i);
+                    break;
+                }
+            }
+        }
+        if (index < 0) {
+            return;
+        }
+        if (static_cast<std::size_t>(index) >= targets.size()) {
+            targets.resize(static_cast<std::size_t>(index) + 1, 0);
+        }
+        targets[static_cast<std::size_t>(index)] |= bit;
+        mapped |= bit;
+    };
+
+    resolve(options.date, kDate);
+    resolve(options.open, kOpen);
+    resolve(options.high, kHigh);
+    resolve(options.low, kLow);
+    resolve(options.close, kClose);
+    resolve(options.volume, kVolume);
+
+    if (!(mapped & kDate) || !(mapped & kClose)) {
+        std::cerr << "CSV error: " << (options.ticker.empty() ? "input" : options.ticker) << " has no "
+                  << ((mapped & kDate) ? options.close.name : options.date.name) << " column" << std::endl;
+        return false;
+    }
+
+    out.ticker = options.ticker;
+    out.timestamps.clear();
+    out.open.clear();
+    out.high.clear();
+    out.low.clear();
+    out.close.clear();
+    out.volume.clear();
+    out.adjclose.clear();
+    out.dividends.clear();
+    out.splits.clear();
+    out.adjusted.factor.clear();
+    out.adjusted.open.clear();
+    out.adjusted.high.clear();
+    out.adjusted.low.clear();
+    out.adjusted.close.clear();
+
+    // Size the columns from the row density of the first chunk
+    if (pos < size) {
+        const std::size_t sample = std::min<std::size_t>(size - pos, 64 * 1024);
+        const auto        lines  = static_cast<std::size_t>(std::count(data + pos, data + pos + sample, '\n'));
+        const std::size_t rows   = lines * (size - pos) / sample + 1;
+        out.timestamps.reserve(rows);
+        out.open.reserve(rows);
+        out.high.reserve(rows);
+        out.low.reserve(rows);
+        out.close.reserve(rows);
+        out.volume.reserve(rows);
+    }
+
+    /* Rows */
+    const std::size_t fieldCount = targets.size();
+    while (pos < size) {
+        int64_t ts     = 0;
+        double  open   = 0.0;
+        double  high   = 0.0;
+        double  low    = 0.0;
+        double  close  = 0.0;
+        int64_t volume = 0;
+        uint8_t parsed = 0;
+
+        for (std::size_t field = 0;; ++field) {
+            const auto end = scanner.next();
+
+            if (field < fieldCount && targets[field] != 0) {
+                const uint8_t bits  = targets[field];
+                const auto    value = trimField(data + pos, data + end);
+                if (bits & kDate) {
+                    if (parseTimestamp(value, ts)) {
+                        parsed |= kDate;
+                    }
+                }
+                if (bits & (kOpen | kHigh | kLow | kClose)) {
+                    double v = 0.0;
+                    if (parseDouble(value, v)) {
+                        open   = (bits & kOpen) ? v : open;
+                        high   = (bits & kHigh) ? v : high;
+                        low    = (bits & kLow) ? v : low;
+                        close  = (bits & kClose) ? v : close;
+                        parsed = static_cast<uint8_t>(parsed | (bits & (kOpen | kHigh | kLow | kClose)));
+                    }
+                }
+                if (bits & kVolume) {
+                    if (parseVolume(value, volume)) {
+                        parsed |= kVolume;
+                    }
+                }
+            }
+
+            pos = end + 1;
+            if (end >= size || data[end] == '\n') {
+                break;
+            }
+        }
+
+        if ((parsed & (kDate | kClose)) != (kDate | kClose)) {
+            continue;  // blank line or null bar
+        }
+
+        out.timestamps.push_back(ts);
+        out.open.push_back((parsed & kOpen) ? open : close);
+        out.high.push_back((parsed & kHigh) ? high : close);
+        out.low.push_back((parsed & kLow) ? low : close);
+        out.close.push_back(close);
+        out.volume.push_back((parsed & kVolume) ? volume : 0);
+    }
+
+    sortByTime(out);
+    return true;
+}
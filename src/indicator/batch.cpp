@@ -0,0 +1,456 @@
+#include "indicator/batch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace indicator {
+
+namespace {
+
+// Windows updated together per bar; the lanes of a group fill a few vector registers
+constexpr std::size_t kLanes = 8;
+
+/* Size `matrix` for `windows` x `bars`, reusing its storage, and NaN-fill each row's warm-up prefix */
+void reshape(IndicatorMatrix& matrix, const std::vector<std::size_t>& windows, std::size_t bars, std::size_t lead) {
+    matrix.windows = windows;
+    matrix.bars    = bars;
+    matrix.values.resize(windows.size() * bars);
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    for (std::size_t r = 0; r < windows.size(); ++r) {
+        const std::size_t w      = windows[r];
+        const std::size_t warmUp = w == 0 || w + lead > bars ? bars : w - 1 + lead;
+        double*           begin  = matrix.row(r);
+        std::fill(begin, begin + warmUp, nan);
+    }
+}
+
+/* Rows whose window is in [1, limit], by ascending window, so a group's lanes start in order */
+std::vector<std::size_t> ascending(const std::vector<std::size_t>& windows, std::size_t limit) {
+    std::vector<std::size_t> order;
+    order.reserve(windows.size());
+    for (std::size_t r = 0; r < windows.size(); ++r) {
+        if (windows[r] >= 1 && windows[r] <= limit) {
+            order.push_back(r);
+        }
+    }
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return windows[a] < windows[b];
+    });
+    return order;
+}
+
+/* One group of rows, padded to kLanes by repeating its last row (which then is written twice, identically) */
+struct Lanes {
+    double*     out[kLanes];
+    std::size_t window[kLanes];
+};
+
+Lanes lanesAt(IndicatorMatrix& matrix, const std::vector<std::size_t>& order, std::size_t begin) {
+    Lanes lanes;
+    for (std::size_t j = 0; j < kLanes; ++j) {
+        const std::size_t row = order[std::min(begin + j, order.size() - 1)];
+        lanes.out[j]          = matrix.row(row);
+        lanes.window[j]       = matrix.windows[row];
+    }
+    return lanes;
+}
+
+/* Running sums prefix[i] = p[0] + ... + p[i - 1], accumulated left to right like the single-window seeds */
+std::vector<double> prefixSums(const std::vector<double>& prices) {
+    std::vector<double> prefix(prices.size() + 1);
+    double              sum = 0.0;
+    prefix[0]               = sum;
+    for (std::size_t i = 0; i < prices.size(); ++i) {
+        sum += prices[i];
+        prefix[i + 1] = sum;
+    }
+    return prefix;
+}
+
+/**
+ * @brief SmaFamilyMode::Prefix: a prefix sum kept as an unevaluated sum hi + lo
+ *        (TwoSum), so a window sum is (hi[b] - hi[a]) + (lo[b] - lo[a]) without the
+ *        cancellation of a plain prefix sum. Each row is one streaming loop.
+ */
+void prefixSmaRows(const std::vector<double>& prices, const std::vector<std::size_t>& order, IndicatorMatrix& matrix) {
+    const std::size_t   n = prices.size();
+    std::vector<double> hi(n + 1);
+    std::vector<double> lo(n + 1);
+    double              sum  = 0.0;
+    double              comp = 0.0;
+    hi[0]                    = 0.0;
+    lo[0]                    = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double next = sum + prices[i];
+        const double back = next - sum;
+        comp += (sum - (next - back)) + (prices[i] - back);
+        sum       = next;
+        hi[i + 1] = sum;
+        lo[i + 1] = comp;
+    }
+
+    for (const std::size_t r : order) {
+        const std::size_t w    = matrix.windows[r];
+        const double      size = static_cast<double>(w);
+        double*           out  = matrix.row(r);
+        for (std::size_t i = w - 1; i < n; ++i) {
+            out[i] = ((hi[i + 1] - hi[i + 1 - w]) + (lo[i + 1] - lo[i + 1 - w])) / size;
+        }
+    }
+}
+
+void smaRows(const std::vector<double>&      prices,
+             const std::vector<std::size_t>& windows,
+             IndicatorMatrix&                matrix,
+             SmaFamilyMode                   mode) {
+    const std::size_t n = prices.size();
+    reshape(matrix, windows, n, 0);
+
+    const auto order = ascending(windows, n);
+    if (order.empty()) {
+        return;
+    }
+    if (mode == SmaFamilyMode::Prefix) {
+        prefixSmaRows(prices, order, matrix);
+        return;
+    }
+    const auto prefix = prefixSums(prices);
+
+    for (std::size_t group = 0; group < order.size(); group += kLanes) {
+        const Lanes lanes = lanesAt(matrix, order, group);
+        double      size[kLanes];
+        double      sum[kLanes]{};
+        for (std::size_t j = 0; j < kLanes; ++j) {
+            size[j] = static_cast<double>(lanes.window[j]);
+        }
+
+        // Warm-up: lanes join one by one as their window fills
+        const std::size_t last = lanes.window[kLanes - 1] - 1;
+        for (std::size_t i = lanes.window[0] - 1; i <= last; ++i) {
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                const std::size_t w = lanes.window[j];
+                if (i + 1 == w) {
+                    sum[j] = prefix[w];
+                } else if (i + 1 > w) {
+                    sum[j] += prices[i] - prices[i - w];
+                } else {
+                    continue;
+                }
+                lanes.out[j][i] = sum[j] / size[j];
+            }
+        }
+
+        // Gather, compute and scatter in separate loops so the arithmetic vectorizes across lanes
+        for (std::size_t i = last + 1; i < n; ++i) {
+            const double added = prices[i];
+            double       removed[kLanes];
+            double       mean[kLanes];
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                removed[j] = prices[i - lanes.window[j]];
+            }
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                sum[j] += added - removed[j];
+                mean[j] = sum[j] / size[j];
+            }
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                lanes.out[j][i] = mean[j];
+            }
+        }
+    }
+}
+
+void emaRows(const std::vector<double>& prices, const std::vector<std::size_t>& periods, IndicatorMatrix& matrix) {
+    const std::size_t n = prices.size();
+    reshape(matrix, periods, n, 0);
+
+    const auto order = ascending(periods, n);
+    if (order.empty()) {
+        return;
+    }
+    const auto prefix = prefixSums(prices);
+
+    for (std::size_t group = 0; group < order.size(); group += kLanes) {
+        const Lanes lanes = lanesAt(matrix, order, group);
+        double      alpha[kLanes];
+        double      value[kLanes]{};
+        for (std::size_t j = 0; j < kLanes; ++j) {
+            alpha[j] = 2.0 / (static_cast<double>(lanes.window[j]) + 1.0);
+        }
+
+        // Warm-up: each lane is seeded with the SMA of its first `period` prices
+        const std::size_t last = lanes.window[kLanes - 1] - 1;
+        for (std::size_t i = lanes.window[0] - 1; i <= last; ++i) {
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                const std::size_t period = lanes.window[j];
+                if (i + 1 == period) {
+                    value[j] = prefix[period] / static_cast<double>(period);
+                } else if (i + 1 > period) {
+                    value[j] += alpha[j] * (prices[i] - value[j]);
+                } else {
+                    continue;
+                }
+                lanes.out[j][i] = value[j];
+            }
+        }
+
+        for (std::size_t i = last + 1; i < n; ++i) {
+            const double p = prices[i];
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                value[j] += alpha[j] * (p - value[j]);
+                lanes.out[j][i] = value[j];
+            }
+        }
+    }
+}
+
+void rsiRows(const std::vector<double>& prices, const std::vector<std::size_t>& periods, IndicatorMatrix& matrix) {
+    const std::size_t n = prices.size();
+    reshape(matrix, periods, n, 1);
+    if (n < 2) {
+        return;
+    }
+
+    const auto order = ascending(periods, n - 1);
+    if (order.empty()) {
+        return;
+    }
+
+    // Running gain/loss sums over the first i changes: the seed of every period, summed in indicator::rsi() order
+    std::vector<double> gainSums(n, 0.0);
+    std::vector<double> lossSums(n, 0.0);
+    for (std::size_t i = 1; i < n; ++i) {
+        const double change = prices[i] - prices[i - 1];
+        gainSums[i]         = gainSums[i - 1];
+        lossSums[i]         = lossSums[i - 1];
+        if (change > 0.0) {
+            gainSums[i] += change;
+        } else {
+            lossSums[i] += -change;
+        }
+    }
+
+    auto value = [](double avgGain, double avgLoss) {
+        return avgLoss < 1e-12 ? 100.0 : 100.0 - (100.0 / (1.0 + avgGain / avgLoss));
+    };
+
+    for (std::size_t group = 0; group < order.size(); group += kLanes) {
+        const Lanes lanes = lanesAt(matrix, order, group);
+        double      smooth[kLanes];
+        double      inv[kLanes];
+        double      avgGain[kLanes]{};
+        double      avgLoss[kLanes]{};
+        for (std::size_t j = 0; j < kLanes; ++j) {
+            smooth[j] = static_cast<double>(lanes.window[j] - 1) / static_cast<double>(lanes.window[j]);
+            inv[j]    = 1.0 / static_cast<double>(lanes.window[j]);
+        }
+
+        auto update = [&](std::size_t j, double change) {
+            if (change > 0.0) {
+                avgGain[j] = avgGain[j] * smooth[j] + change * inv[j];
+                avgLoss[j] = avgLoss[j] * smooth[j];
+            } else {
+                avgGain[j] = avgGain[j] * smooth[j];
+                avgLoss[j] = avgLoss[j] * smooth[j] + (-change) * inv[j];
+            }
+        };
+
+        // Warm-up: lanes join one by one at bar `period`
+        const std::size_t last = lanes.window[kLanes - 1];
+        for (std::size_t i = lanes.window[0]; i <= last; ++i) {
+            const double change = prices[i] - prices[i - 1];
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                const std::size_t period = lanes.window[j];
+                if (i == period) {
+                    avgGain[j] = gainSums[i] / static_cast<double>(period);
+                    avgLoss[j] = lossSums[i] / static_cast<double>(period);
+                } else if (i > period) {
+                    update(j, change);
+                } else {
+                    continue;
+                }
+                lanes.out[j][i] = value(avgGain[j], avgLoss[j]);
+            }
+        }
+
+        // The gain/loss branch depends only on the bar, so it is taken once for the whole group
+        for (std::size_t i = last + 1; i < n; ++i) {
+            const double change = prices[i] - prices[i - 1];
+            if (change > 0.0) {
+                for (std::size_t j = 0; j < kLanes; ++j) {
+                    avgGain[j] = avgGain[j] * smooth[j] + change * inv[j];
+                    avgLoss[j] = avgLoss[j] * smooth[j];
+                }
+            } else {
+                for (std::size_t j = 0; j < kLanes; ++j) {
+                    avgGain[j] = avgGain[j] * smooth[j];
+                    avgLoss[j] = avgLoss[j] * smooth[j] + (-change) * inv[j];
+                }
+            }
+            double rsi[kLanes];
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                rsi[j] = value(avgGain[j], avgLoss[j]);
+            }
+            for (std::size_t j = 0; j < kLanes; ++j) {
+                lanes.out[j][i] = rsi[j];
+            }
+        }
+    }
+}
+
+/* Copy the rows of `part` (computed over prices[from, from + part.bars)) into `matrix` at bar `from` */
+void place(const IndicatorMatrix& part, std::size_t from, IndicatorMatrix& matrix) {
+    for (std::size_t r = 0; r < matrix.rows(); ++r) {
+        std::copy(part.row(r), part.row(r) + part.bars, matrix.row(r) + from);
+    }
+}
+
+/**
+ * @brief Run `rows` (a family over a gap-free series) under `policy`, into `matrix`
+ *        aligned to `prices`; the same layouts as the gaps.hpp functions.
+ */
+template <typename Rows>
+void withGaps(const std::vector<double>&      prices,
+              const std::vector<std::size_t>& windows,
+              GapPolicy                       policy,
+              IndicatorMatrix&                matrix,
+              Rows                            rows) {
+    const std::size_t gaps = gapCount(prices);
+    if (gaps == 0) {
+        rows(prices, windows, matrix);
+        return;
+    }
+
+    const std::size_t n   = prices.size();
+    const double      nan = std::numeric_limits<double>::quiet_NaN();
+    matrix.windows        = windows;
+    matrix.bars           = n;
+    matrix.values.assign(windows.size() * n, nan);
+
+    IndicatorMatrix part;
+    switch (policy) {
+    case GapPolicy::Propagate: {
+        // Each run of valid bars is an independent series
+        std::size_t begin = 0;
+        while (begin < n) {
+            while (begin < n && std::isnan(prices[begin])) {
+                ++begin;
+            }
+            std::size_t end = begin;
+            while (end < n && !std::isnan(prices[end])) {
+                ++end;
+            }
+            if (end > begin) {
+                rows(std::vector<double>(prices.begin() + begin, prices.begin() + end), windows, part);
+                place(part, begin, matrix);
+            }
+            begin = end;
+        }
+        break;
+    }
+    case GapPolicy::ForwardFill: {
+        const auto  filled = forwardFill(prices);
+        std::size_t first  = 0;
+        while (first < n && std::isnan(filled[first])) {
+            ++first;
+        }
+        if (first < n) {
+            rows(std::vector<double>(filled.begin() + first, filled.end()), windows, part);
+            place(part, first, matrix);
+        }
+        break;
+    }
+    case GapPolicy::Skip: {
+        std::vector<double> valid;
+        valid.reserve(n - gaps);
+        for (const double price : prices) {
+            if (!std::isnan(price)) {
+                valid.push_back(price);
+            }
+        }
+        rows(valid, windows, part);
+        for (std::size_t r = 0; r < matrix.rows(); ++r) {
+            const double* from = part.row(r);
+            double*       to   = matrix.row(r);
+            for (std::size_t i = 0; i < n; ++i) {
+                if (!std::isnan(prices[i])) {
+                    to[i] = *from++;
+                }
+            }
+        }
+        break;
+    }
+    }
+}
+
+}  // namespace
+
+std::size_t IndicatorMatrix::rowOf(std::size_t window) const {
+    return static_cast<std::size_t>(std::find(windows.begin(), windows.end(), window) - windows.begin());
+}
+
+std::vector<std::size_t> windowRange(std::size_t first, std::size_t last, std::size_t step) {
+    std::vector<std::size_t> windows;
+    if (step == 0) {
+        step = 1;
+    }
+    for (std::size_t w = first; w <= last; w += step) {
+        windows.push_back(w);
+        if (last - w < step) {
+            break;
+        }
+    }
+    return windows;
+}
+
+IndicatorMatrix smaFamily(const std::vector<double>&      prices,
+                          const std::vector<std::size_t>& windows,
+                          SmaFamilyMode                   mode,
+                          GapPolicy                       gaps) {
+    IndicatorMatrix matrix;
+    smaFamily(prices, windows, matrix, mode, gaps);
+    return matrix;
+}
+
+void smaFamily(const std::vector<double>&      prices,
+               const std::vector<std::size_t>& windows,
+               IndicatorMatrix&                matrix,
+               SmaFamilyMode                   mode,
+               GapPolicy                       gaps) {
+    withGaps(prices, windows, gaps, matrix, [mode](const auto& clean, const auto& rows, IndicatorMatrix& out) {
+        smaRows(clean, rows, out, mode);
+    });
+}
+
+IndicatorMatrix emaFamily(const std::vector<double>&      prices,
+                          const std::vector<std::size_t>& periods,
+                          GapPolicy                       gaps) {
+    IndicatorMatrix matrix;
+    emaFamily(prices, periods, matrix, gaps);
+    return matrix;
+}
+
+void emaFamily(const std::vector<double>&      prices,
+               const std::vector<std::size_t>& periods,
+               IndicatorMatrix&                matrix,
+               GapPolicy                       gaps) {
+    withGaps(prices, periods, gaps, matrix, emaRows);
+}
+
+IndicatorMatrix rsiFamily(const std::vector<double>&      prices,
+                          const std::vector<std::size_t>& periods,
+                          GapPolicy                       gaps) {
+    IndicatorMatrix matrix;
+    rsiFamily(prices, periods, matrix, gaps);
+    return matrix;
+}
+
+void rsiFamily(const std::vector<double>&      prices,
+               const std::vector<std::size_t>& periods,
+               IndicatorMatrix&                matrix,
+               GapPolicy                       gaps) {
+    withGaps(prices, periods, gaps, matrix, rsiRows);
+}
+
+}  // namespace indicator
@@ -0,0 +1,200 @@
+#include "indicator/cache.hpp"
+
+#include <exception>
+
+#include "indicator.hpp"
+#include "indicator/gaps.hpp"
+
+namespace indicator {
+
+namespace {
+
+uint64_t mix(uint64_t h, uint64_t v) {
+    // splitmix64 finalizer over the running hash
+    h ^= v + 0x9E3779B97F4A7C15ULL + (h << 6) + (h >> 2);
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBULL;
+    h ^= h >> 31;
+    return h;
+}
+
+/* Key parameter of a window computed under a gap policy */
+uint64_t withPolicy(std::size_t window, GapPolicy gaps) {
+    return static_cast<uint64_t>(window) | static_cast<uint64_t>(gaps) << 56;
+}
+
+}  // namespace
+
+SeriesKey SeriesKey::of(const std::vector<double>& values, uint64_t version) {
+    SeriesKey key;
+    key.identity = values.data();
+    key.size     = values.size();
+    key.version  = version;
+    return key;
+}
+
+std::size_t IndicatorKeyHash::operator()(const IndicatorKey& key) const {
+    uint64_t h = mix(0, reinterpret_cast<uintptr_t>(key.series.identity));
+    h          = mix(h, key.series.size);
+    h          = mix(h, key.series.version);
+    h          = mix(h, static_cast<uint64_t>(key.kind));
+    h          = mix(h, key.param);
+    return static_cast<std::size_t>(h);
+}
+
+IndicatorCache::IndicatorCache(std::size_t capacityBytes)
+    : capacityBytes_(capacityBytes) {}
+
+IndicatorCache::Values IndicatorCache::sma(const std::vector<double>& prices, uint64_t version, std::size_t window) {
+    return getOrCompute({SeriesKey::of(prices, version), IndicatorKind::Sma, window},
+                        [&] { return indicator::sma(prices, window); });
+}
+
+IndicatorCache::Values IndicatorCache::ema(const std::vector<double>& prices, uint64_t version, std::size_t period) {
+    return getOrCompute({SeriesKey::of(prices, version), IndicatorKind::Ema, period},
+                        [&] { return indicator::ema(prices, period); });
+}
+
+IndicatorCache::Values IndicatorCache::rsi(const std::vector<double>& prices, uint64_t version, std::size_t period) {
+    return getOrCompute({SeriesKey::of(prices, version), IndicatorKind::Rsi, period},
+                        [&] { return indicator::rsi(prices, period); });
+}
+
+IndicatorCache::Values IndicatorCache::variance(const std::vector<double>& prices, uint64_t version,
+                                                std::size_t window) {
+    return getOrCompute({SeriesKey::of(prices, version), IndicatorKind::Variance, window},
+                        [&] { return indicator::variance(prices, window); });
+}
+
+IndicatorCache::Values IndicatorCache::rollingMax(const std::vector<double>& values, uint64_t version,
+                                                  std::size_t window) {
+    return getOrCompute({SeriesKey::of(values, version), IndicatorKind::RollingMax, window},
+                        [&] { return indicator::rollingMax(values, window); });
+}
+
+IndicatorCache::Values IndicatorCache::rollingMin(const std::vector<double>& values, uint64_t version,
+                                                  std::size_t window) {
+    return getOrCompute({SeriesKey::of(values, version), IndicatorKind::RollingMin, window},
+                        [&] { return indicator::rollingMin(values, window); });
+}
+
+IndicatorCache::Values IndicatorCache::alignedSma(const std::vector<double>& prices,
+                                                  uint64_t                   version,
+                                                  std::size_t                window,
+                                                  GapPolicy                  gaps) {
+    return getOrCompute({SeriesKey::of(prices, version), IndicatorKind::AlignedSma, withPolicy(window, gaps)}, [&] {
+        std::vector<double> out;
+        indicator::smaInto(prices, window, gaps, out);
+        return out;
+    });
+}
+
+IndicatorCache::Values IndicatorCache::alignedRsi(const std::vector<double>& prices,
+                                                  uint64_t                   version,
+                                                  std::size_t                period,
+                                                  GapPolicy                  gaps) {
+    return getOrCompute({SeriesKey::of(prices, version), IndicatorKind::AlignedRsi, withPolicy(period, gaps)}, [&] {
+        std::vector<double> out;
+        indicator::rsiInto(prices, period, gaps, out);
+        return out;
+    });
+}
+
+IndicatorCache::Values IndicatorCache::getOrCompute(const IndicatorKey&                         key,
+                                                    const std::function<std::vector<double>()>& compute) {
+    std::promise<Values> promise;
+    uint64_t             ticket = 0;
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const auto                   it = entries_.find(key);
+        if (it != entries_.end()) {
+            ++hits_;
+            lru_.splice(lru_.begin(), lru_, it->second.lru);
+            const auto value = it->second.value;
+            lock.unlock();
+            return value.get();  // waits if another thread is still computing it
+        }
+
+        ++misses_;
+        ticket = nextTicket_++;
+        lru_.push_front(key);
+        entries_.emplace(key, Entry{promise.get_future().share(), 0, ticket, lru_.begin()});
+    }
+
+    // Compute outside the lock; other requests for this key wait on the future
+    Values value;
+    try {
+        value = std::make_shared<const std::vector<double>>(compute());
+    } catch (...) {
+        promise.set_exception(std::current_exception());
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto                  it = entries_.find(key);
+        if (it != entries_.end() && it->second.ticket == ticket) {
+            lru_.erase(it->second.lru);
+            entries_.erase(it);
+        }
+        throw;
+    }
+    promise.set_value(value);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto                  it = entries_.find(key);
+    if (it != entries_.end() && it->second.ticket == ticket) {
+        it->second.bytes = sizeof(std::vector<double>) + value->capacity() * sizeof(double);
+        bytes_ += it->second.bytes;
+        evict();
+    }
+    return value;
+}
+
+void IndicatorCache::evict() {
+    auto it = lru_.end();
+    while (bytes_ > capacityBytes_ && it != lru_.begin()) {
+        --it;
+        const auto entry = entries_.find(*it);
+        if (entry->second.bytes == 0) {
+            continue;  // in flight
+        }
+        bytes_ -= entry->second.bytes;
+        entries_.erase(entry);
+        it = lru_.erase(it);
+        ++evictions_;
+    }
+}
+
+void IndicatorCache::invalidate(const std::vector<double>& values) {
+    // Match on the buffer only, so entries of every version go
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->first.series.identity == values.data()) {
+            bytes_ -= it->second.bytes;
+            lru_.erase(it->second.lru);
+            it = entries_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void IndicatorCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+    bytes_ = 0;
+}
+
+IndicatorCache::Stats IndicatorCache::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    Stats                       stats;
+    stats.hits      = hits_;
+    stats.misses    = misses_;
+    stats.evictions = evictions_;
+    stats.entries   = entries_.size();
+    stats.bytes     = bytes_;
+    return stats;
+}
+
+}  // namespace indicator
@@ -0,0 +1,84 @@
+#include "indicator/drawdown.hpp"
+
+#include <algorithm>
+
+#include "indicator.hpp"
+
+namespace indicator {
+
+double maxDrawdownPct(const std::vector<double>& equity) {
+    if (equity.empty()) {
+        return 0.0;
+    }
+
+    double peak  = equity[0];
+    double maxDD = 0.0;
+    for (const auto& eq : equity) {
+        peak            = std::max(peak, eq);
+        const double dd = (eq - peak) / peak * 100.0;
+        maxDD           = std::min(maxDD, dd);
+    }
+    return maxDD;
+}
+
+DrawdownStats drawdownStats(const std::vector<double>& equity) {
+    DrawdownStats stats;
+    if (equity.empty()) {
+        return stats;
+    }
+
+    double      peak      = equity[0];
+    std::size_t peakIndex = 0;
+    std::size_t below     = 0;
+    for (std::size_t i = 0; i < equity.size(); ++i) {
+        const double eq = equity[i];
+        if (eq >= peak) {
+            if (stats.recovery == DrawdownStats::npos && stats.maxDrawdownPct < 0.0 && stats.peak == peakIndex) {
+                stats.recovery = i;
+            }
+            peak      = eq;
+            peakIndex = i;
+            below     = 0;
+            continue;
+        }
+
+        below                   = below + 1;
+        stats.longestUnderwater = std::max(stats.longestUnderwater, below);
+
+        const double dd = (eq - peak) / peak * 100.0;
+        if (dd < stats.maxDrawdownPct) {
+            stats.maxDrawdownPct = dd;
+            stats.peak           = peakIndex;
+            stats.trough         = i;
+            stats.recovery       = DrawdownStats::npos;
+        }
+    }
+    return stats;
+}
+
+Underwater underwater(const std::vector<double>& equity) {
+    Underwater curve;
+    curve.depthPct.reserve(equity.size());
+    curve.duration.reserve(equity.size());
+
+    double      peak  = equity.empty() ? 0.0 : equity[0];
+    std::size_t below = 0;
+    for (const auto& eq : equity) {
+        peak  = std::max(peak, eq);
+        below = eq < peak ? below + 1 : 0;
+        curve.depthPct.push_back((eq - peak) / peak * 100.0);
+        curve.duration.push_back(below);
+    }
+    return curve;
+}
+
+std::vector<double> rollingDrawdown(const std::vector<double>& equity, std::size_t window) {
+    auto result = rollingMax(equity, window);
+    for (std::size_t j = 0; j < result.size(); ++j) {
+        const double eq = equity[j + window - 1];
+        result[j]       = (eq - result[j]) / result[j] * 100.0;
+    }
+    return result;
+}
+
+}  // namespace indicator
@@ -0,0 +1,519 @@
+#include "indicator/expr.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <tuple>
+#include <unordered_map>
+
+#include "indicator/state.hpp"
+
+namespace indicator::expr {
+
+enum class Op : uint8_t
+{
+    // Inputs
+    Open,
+    High,
+    Low,
+    Close,
+    Volume,
+    Constant,
+    // Element-wise
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Neg,
+    Abs,
+    Log,
+    Greater,
+    Less,
+    Min,
+    Max,
+    // Windowed (carry state across blocks)
+    Sma,
+    Ema,
+    Rsi,
+    Stddev,
+    RollingMax,
+    RollingMin,
+    Lag,
+};
+
+struct Node {
+    Op                          op    = Op::Constant;
+    std::size_t                 param = 0;    // window / period / lag
+    double                      value = 0.0;  // Op::Constant
+    std::shared_ptr<const Node> lhs;
+    std::shared_ptr<const Node> rhs;
+};
+
+Expr makeExpr(std::shared_ptr<const Node> node) {
+    return Expr(std::move(node));
+}
+
+namespace {
+
+constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+// Bars per block: small enough that every node's block stays in L1/L2 between stages
+constexpr std::size_t kBlock = 256;
+
+Expr leaf(Op op, double value = 0.0) {
+    auto node   = std::make_shared<Node>();
+    node->op    = op;
+    node->value = value;
+    return makeExpr(std::move(node));
+}
+
+Expr unary(Op op, const Expr& operand, std::size_t param = 0) {
+    auto node   = std::make_shared<Node>();
+    node->op    = op;
+    node->param = param;
+    node->lhs   = operand.node();
+    return makeExpr(std::move(node));
+}
+
+Expr binary(Op op, const Expr& lhs, const Expr& rhs) {
+    auto node = std::make_shared<Node>();
+    node->op  = op;
+    node->lhs = lhs.node();
+    node->rhs = rhs.node();
+    return makeExpr(std::move(node));
+}
+
+/**
+ * @brief The graph flattened into steps in dependency order, one per distinct
+ *        (op, param, constant, inputs) tuple; a step's inputs are earlier steps.
+ */
+class Program {
+   public:
+    static constexpr std::size_t none = static_cast<std::size_t>(-1);
+
+    struct Step {
+        Op          op    = Op::Constant;
+        std::size_t param = 0;
+        double      value = 0.0;
+        std::size_t lhs   = none;
+        std::size_t rhs   = none;
+    };
+
+    std::size_t add(const Node& node) {
+        const auto seen = visited_.find(&node);
+        if (seen != visited_.end()) {
+            return seen->second;
+        }
+
+        Step step;
+        step.op    = node.op;
+        step.param = node.param;
+        step.value = node.value;
+        step.lhs   = node.lhs ? add(*node.lhs) : none;
+        step.rhs   = node.rhs ? add(*node.rhs) : none;
+
+        uint64_t valueBits;
+        std::memcpy(&valueBits, &step.value, sizeof(valueBits));
+        const auto key      = std::make_tuple(step.op, step.param, valueBits, step.lhs, step.rhs);
+        const auto inserted = index_.emplace(key, steps_.size());
+        if (inserted.second) {
+            steps_.push_back(step);
+        }
+        visited_.emplace(&node, inserted.first->second);
+        return inserted.first->second;
+    }
+
+    [[nodiscard]] const std::vector<Step>& steps() const { return steps_; }
+
+   private:
+    using Key = std::tuple<Op, std::size_t, uint64_t, std::size_t, std::size_t>;
+
+    std::vector<Step>                            steps_;
+    std::map<Key, std::size_t>                   index_;
+    std::unordered_map<const Node*, std::size_t> visited_;
+};
+
+/* Windowed steps: consume a block of their input and write a block of output */
+
+class Windowed {
+   public:
+    virtual ~Windowed()                                            = default;
+    virtual void run(const double* in, double* out, std::size_t n) = 0;
+};
+
+// NaN inputs are skipped, so a chain starts once its input has warmed up
+template <typename State>
+class StateStep : public Windowed {
+   public:
+    explicit StateStep(std::size_t window) : state_(window) {}
+
+    void run(const double* in, double* out, std::size_t n) override {
+        for (std::size_t k = 0; k < n; ++k) {
+            if (std::isnan(in[k])) {
+                out[k] = kNaN;
+                continue;
+            }
+            state_.update(in[k]);
+            out[k] = state_.value();
+        }
+    }
+
+   private:
+    State state_;
+};
+
+class StddevStep : public Windowed {
+   public:
+    explicit StddevStep(std::size_t window) : state_(window) {}
+
+    void run(const double* in, double* out, std::size_t n) override {
+        for (std::size_t k = 0; k < n; ++k) {
+            if (std::isnan(in[k])) {
+                out[k] = kNaN;
+                continue;
+            }
+            state_.update(in[k]);
+            out[k] = std::sqrt(state_.value());
+        }
+    }
+
+   private:
+    VarianceState state_;
+};
+
+class LagStep : public Windowed {
+   public:
+    explicit LagStep(std::size_t bars) : ring_(bars, kNaN) {}
+
+    void run(const double* in, double* out, std::size_t n) override {
+        if (ring_.empty()) {
+            std::copy(in, in + n, out);
+            return;
+        }
+        for (std::size_t k = 0; k < n; ++k) {
+            out[k]       = ring_[head_];
+            ring_[head_] = in[k];
+            head_        = head_ + 1 == ring_.size() ? 0 : head_ + 1;
+        }
+    }
+
+   private:
+    std::vector<double> ring_;
+    std::size_t         head_ = 0;
+};
+
+std::unique_ptr<Windowed> makeWindowed(const Program::Step& step) {
+    switch (step.op) {
+    case Op::Sma:
+        return std::make_unique<StateStep<SmaState>>(step.param);
+    case Op::Ema:
+        return std::make_unique<StateStep<EmaState>>(step.param);
+    case Op::Rsi:
+        return std::make_unique<StateStep<RsiState>>(step.param);
+    case Op::RollingMax:
+        return std::make_unique<StateStep<RollingMaxState>>(step.param);
+    case Op::RollingMin:
+        return std::make_unique<StateStep<RollingMinState>>(step.param);
+    case Op::Stddev:
+        return std::make_unique<StddevStep>(step.param);
+    case Op::Lag:
+        return std::make_unique<LagStep>(step.param);
+    default:
+        return nullptr;
+    }
+}
+
+const std::vector<double>* priceColumn(Op op, const StockInfo& data) {
+    switch (op) {
+    case Op::Open:
+        return &data.open;
+    case Op::High:
+        return &data.high;
+    case Op::Low:
+        return &data.low;
+    case Op::Close:
+        return &data.close;
+    default:
+        return nullptr;
+    }
+}
+
+template <typename F>
+void map(const double* a, double* out, std::size_t n, F f) {
+    for (std::size_t k = 0; k < n; ++k) {
+        out[k] = f(a[k]);
+    }
+}
+
+template <typename F>
+void zip(const double* a, const double* b, double* out, std::size_t n, F f) {
+    for (std::size_t k = 0; k < n; ++k) {
+        out[k] = f(a[k], b[k]);
+    }
+}
+
+double compare(double a, double b, bool holds) {
+    return std::isnan(a) || std::isnan(b) ? kNaN : (holds ? 1.0 : 0.0);
+}
+
+double nanMin(double a, double b) {
+    return std::isnan(a) || std::isnan(b) ? kNaN : std::min(a, b);
+}
+
+double nanMax(double a, double b) {
+    return std::isnan(a) || std::isnan(b) ? kNaN : std::max(a, b);
+}
+
+}  // namespace
+
+Expr Expr::sma(std::size_t window) const {
+    return unary(Op::Sma, *this, window);
+}
+
+Expr Expr::ema(std::size_t period) const {
+    return unary(Op::Ema, *this, period);
+}
+
+Expr Expr::rsi(std::size_t period) const {
+    return unary(Op::Rsi, *this, period);
+}
+
+Expr Expr::stddev(std::size_t window) const {
+    return unary(Op::Stddev, *this, window);
+}
+
+Expr Expr::rollingMax(std::size_t window) const {
+    return unary(Op::RollingMax, *this, window);
+}
+
+Expr Expr::rollingMin(std::size_t window) const {
+    return unary(Op::RollingMin, *this, window);
+}
+
+Expr Expr::lag(std::size_t bars) const {
+    return unary(Op::Lag, *this, bars);
+}
+
+Expr Expr::abs() const {
+    return unary(Op::Abs, *this);
+}
+
+Expr Expr::log() const {
+    return unary(Op::Log, *this);
+}
+
+Expr operator+(const Expr& lhs, const Expr& rhs) {
+    return binary(Op::Add, lhs, rhs);
+}
+
+Expr operator-(const Expr& lhs, const Expr& rhs) {
+    return binary(Op::Sub, lhs, rhs);
+}
+
+Expr operator*(const Expr& lhs, const Expr& rhs) {
+    return binary(Op::Mul, lhs, rhs);
+}
+
+Expr operator/(const Expr& lhs, const Expr& rhs) {
+    return binary(Op::Div, lhs, rhs);
+}
+
+Expr operator-(const Expr& operand) {
+    return unary(Op::Neg, operand);
+}
+
+Expr operator>(const Expr& lhs, const Expr& rhs) {
+    return binary(Op::Greater, lhs, rhs);
+}
+
+Expr operator<(const Expr& lhs, const Expr& rhs) {
+    return binary(Op::Less, lhs, rhs);
+}
+
+Expr min(const Expr& lhs, const Expr& rhs) {
+    return binary(Op::Min, lhs, rhs);
+}
+
+Expr max(const Expr& lhs, const Expr& rhs) {
+    return binary(Op::Max, lhs, rhs);
+}
+
+Expr operator+(const Expr& lhs, double rhs) {
+    return lhs + constant(rhs);
+}
+
+Expr operator+(double lhs, const Expr& rhs) {
+    return constant(lhs) + rhs;
+}
+
+Expr operator-(const Expr& lhs, double rhs) {
+    return lhs - constant(rhs);
+}
+
+Expr operator-(double lhs, const Expr& rhs) {
+    return constant(lhs) - rhs;
+}
+
+Expr operator*(const Expr& lhs, double rhs) {
+    return lhs * constant(rhs);
+}
+
+Expr operator*(double lhs, const Expr& rhs) {
+    return constant(lhs) * rhs;
+}
+
+Expr operator/(const Expr& lhs, double rhs) {
+    return lhs / constant(rhs);
+}
+
+Expr operator/(double lhs, const Expr& rhs) {
+    return constant(lhs) / rhs;
+}
+
+Expr open() {
+    return leaf(Op::Open);
+}
+
+Expr high() {
+    return leaf(Op::High);
+}
+
+Expr low() {
+    return leaf(Op::Low);
+}
+
+Expr close() {
+    return leaf(Op::Close);
+}
+
+Expr volume() {
+    return leaf(Op::Volume);
+}
+
+Expr constant(double value) {
+    return leaf(Op::Constant, value);
+}
+
+std::vector<double> evaluate(const Expr& expr, const StockInfo& data) {
+    auto result = evaluate(std::vector<Expr>{expr}, data);
+    return result.empty() ? std::vector<double>{} : std::move(result.front());
+}
+
+std::vector<std::vector<double>> evaluate(const std::vector<Expr>& exprs, const StockInfo& data) {
+    Program                  program;
+    std::vector<std::size_t> outputs;
+    outputs.reserve(exprs.size());
+    for (const auto& expr : exprs) {
+        outputs.push_back(program.add(*expr.node()));
+    }
+    const auto& steps = program.steps();
+
+    const std::size_t bars = data.close.size();
+    for (const auto& step : steps) {
+        const auto*       prices = priceColumn(step.op, data);
+        const std::size_t size   = prices ? prices->size() : step.op == Op::Volume ? data.volume.size() : bars;
+        if (size != bars) {
+            std::cerr << "Expression input has " << size << " bars, close has " << bars << std::endl;
+            return {};
+        }
+    }
+
+    // Every step writes its block to its own scratch row; price columns are read in place
+    std::vector<double>                    scratch(steps.size() * kBlock);
+    std::vector<const double*>             in(steps.size());
+    std::vector<std::unique_ptr<Windowed>> windowed(steps.size());
+    for (std::size_t s = 0; s < steps.size(); ++s) {
+        in[s]       = scratch.data() + s * kBlock;
+        windowed[s] = makeWindowed(steps[s]);
+        if (steps[s].op == Op::Constant) {
+            std::fill_n(scratch.data() + s * kBlock, kBlock, steps[s].value);
+        }
+    }
+
+    std::vector<std::vector<double>> result(exprs.size());
+    for (auto& values : result) {
+        values.reserve(bars);
+    }
+
+    for (std::size_t begin = 0; begin < bars; begin += kBlock) {
+        const std::size_t n = std::min(kBlock, bars - begin);
+        for (std::size_t s = 0; s < steps.size(); ++s) {
+            const auto&   step = steps[s];
+            double*       out  = scratch.data() + s * kBlock;
+            const double* a    = step.lhs != Program::none ? in[step.lhs] : nullptr;
+            const double* b    = step.rhs != Program::none ? in[step.rhs] : nullptr;
+
+            switch (step.op) {
+            case Op::Open:
+            case Op::High:
+            case Op::Low:
+            case Op::Close:
+                in[s] = priceColumn(step.op, data)->data() + begin;
+                break;
+            case Op::Volume:
+                for (std::size_t k = 0; k < n; ++k) {
+                    out[k] = static_cast<double>(data.volume[begin + k]);
+                }
+                break;
+            case Op::Constant:
+                break;
+            case Op::Add:
+                zip(a, b, out, n, [](double x, double y) { return x + y; });
+                break;
+            case Op::Sub:
+                zip(a, b, out, n, [](double x, double y) { return x - y; });
+                break;
+            case Op::Mul:
+                zip(a, b, out, n, [](double x, double y) { return x * y; });
+                break;
+            case Op::Div:
+                zip(a, b, out, n, [](double x, double y) { return x / y; });
+                break;
+            case Op::Neg:
+                map(a, out, n, [](double x) { return -x; });
+                break;
+            case Op::Abs:
+                map(a, out, n, [](double x) { return std::abs(x); });
+                break;
+            case Op::Log:
+                map(a, out, n, [](double x) { return std::log(x); });
+                break;
+            case Op::Greater:
+                zip(a, b, out, n, [](double x, double y) { return compare(x, y, x > y); });
+                break;
+            case Op::Less:
+                zip(a, b, out, n, [](double x, double y) { return compare(x, y, x < y); });
+                break;
+            case Op::Min:
+                zip(a, b, out, n, [](double x, double y) { return nanMin(x, y); });
+                break;
+            case Op::Max:
+                zip(a, b, out, n, [](double x, double y) { return nanMax(x, y); });
+                break;
+            default:
+                windowed[s]->run(a, out, n);
+                break;
+            }
+        }
+
+        for (std::size_t j = 0; j < outputs.size(); ++j) {
+            const double* values = in[outputs[j]];
+            result[j].insert(result[j].end(), values, values + n);
+        }
+    }
+    return result;
+}
+
+std::size_t distinctNodes(const std::vector<Expr>& exprs) {
+    Program program;
+    for (const auto& expr : exprs) {
+        program.add(*expr.node());
+    }
+    return program.steps().size();
+}
+
+}  // namespace indicator::expr
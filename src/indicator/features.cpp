@@ -0,0 +1,310 @@
+#include "indicator/features.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+#include "indicator/state.hpp"
+
+namespace indicator {
+
+namespace {
+
+std::vector<double> column(std::size_t bars) {
+    return std::vector<double>(bars, std::numeric_limits<double>::quiet_NaN());
+}
+
+/* Each kernel consumes one bar per step() and writes its outputs at that bar; missing (NaN) bars are skipped */
+
+struct MacdKernel {
+    MacdKernel(Macd& result, std::size_t bars, std::size_t fastPeriod, std::size_t slowPeriod, std::size_t signalPeriod)
+        : out(result), fast(fastPeriod), slow(slowPeriod), signal(signalPeriod) {
+        out.line      = column(bars);
+        out.signal    = column(bars);
+        out.histogram = column(bars);
+    }
+
+    void step(std::size_t i, double close) {
+        if (std::isnan(close)) {
+            return;
+        }
+        fast.update(close);
+        slow.update(close);
+        if (!fast.ready() || !slow.ready()) {
+            return;
+        }
+
+        const double line = fast.value() - slow.value();
+        out.line[i]       = line;
+        signal.update(line);
+        if (signal.ready()) {
+            out.signal[i]    = signal.value();
+            out.histogram[i] = line - signal.value();
+        }
+    }
+
+    Macd&    out;
+    EmaState fast;
+    EmaState slow;
+    EmaState signal;
+};
+
+struct BollingerKernel {
+    BollingerKernel(BollingerBands& result, std::size_t bars, std::size_t window, double bandWidth)
+        : out(result), variance(window), width(bandWidth) {
+        out.middle = column(bars);
+        out.upper  = column(bars);
+        out.lower  = column(bars);
+        out.stddev = column(bars);
+        out.zscore = column(bars);
+    }
+
+    void step(std::size_t i, double close) {
+        if (std::isnan(close)) {
+            return;
+        }
+        variance.update(close);
+        if (!variance.ready()) {
+            return;
+        }
+
+        const double mean = variance.mean();
+        const double sd   = std::sqrt(variance.value());
+        out.middle[i]     = mean;
+        out.upper[i]      = mean + width * sd;
+        out.lower[i]      = mean - width * sd;
+        out.stddev[i]     = sd;
+        out.zscore[i]     = sd > 0.0 ? (close - mean) / sd : 0.0;
+    }
+
+    BollingerBands& out;
+    VarianceState   variance;
+    double          width;
+};
+
+struct AtrKernel {
+    AtrKernel(std::vector<double>& result, std::size_t bars, std::size_t atrPeriod)
+        : out(result), period(atrPeriod == 0 ? 1 : atrPeriod) {
+        out = column(bars);
+    }
+
+    void step(std::size_t i, double high, double low, double close) {
+        if (std::isnan(high) || std::isnan(low) || std::isnan(close)) {
+            return;
+        }
+        double range = high - low;
+        if (started) {
+            range = std::max({range, std::fabs(high - prevClose), std::fabs(low - prevClose)});
+        }
+        prevClose = close;
+        started   = true;
+
+        if (count < period) {
+            // Seed: mean of the first `period` true ranges
+            value += range;
+            if (++count < period) {
+                return;
+            }
+            value /= static_cast<double>(period);
+        } else {
+            value = (value * static_cast<double>(period - 1) + range) / static_cast<double>(period);
+        }
+        out[i] = value;
+    }
+
+    std::vector<double>& out;
+    std::size_t          period;
+    std::size_t          count     = 0;
+    double               value     = 0.0;
+    double               prevClose = 0.0;
+    bool                 started   = false;  // a valid bar was seen, so prevClose is set
+};
+
+struct DonchianKernel {
+    DonchianKernel(DonchianChannel& result, std::size_t bars, std::size_t window)
+        : out(result), highest(window), lowest(window) {
+        out.upper  = column(bars);
+        out.lower  = column(bars);
+        out.middle = column(bars);
+    }
+
+    void step(std::size_t i, double high, double low) {
+        if (std::isnan(high) || std::isnan(low)) {
+            return;
+        }
+        highest.update(high);
+        lowest.update(low);
+        if (!highest.ready()) {
+            return;
+        }
+
+        out.upper[i]  = highest.value();
+        out.lower[i]  = lowest.value();
+        out.middle[i] = (out.upper[i] + out.lower[i]) / 2.0;
+    }
+
+    DonchianChannel& out;
+    RollingMaxState  highest;
+    RollingMinState  lowest;
+};
+
+struct ObvKernel {
+    ObvKernel(std::vector<double>& result, std::size_t bars) : out(result) { out = column(bars); }
+
+    void step(std::size_t i, double close, int64_t volume) {
+        if (std::isnan(close)) {
+            return;
+        }
+        if (started) {
+            if (close > prevClose) {
+                value += static_cast<double>(volume);
+            } else if (close < prevClose) {
+                value -= static_cast<double>(volume);
+            }
+        }
+        prevClose = close;
+        started   = true;
+        out[i]    = value;
+    }
+
+    std::vector<double>& out;
+    double               value     = 0.0;
+    double               prevClose = 0.0;
+    bool                 started   = false;
+};
+
+/* A streaming state whose value() is written at every bar once ready */
+template <typename State>
+struct StateKernel {
+    StateKernel(std::vector<double>& result, std::size_t bars, std::size_t window) : out(result), state(window) {
+        out = column(bars);
+    }
+
+    void step(std::size_t i, double close) {
+        if (std::isnan(close)) {
+            return;
+        }
+        state.update(close);
+        if (state.ready()) {
+            out[i] = state.value();
+        }
+    }
+
+    std::vector<double>& out;
+    State                state;
+};
+
+bool sameLength(const StockInfo& data, bool withVolume) {
+    const std::size_t n = data.close.size();
+    if (data.high.size() != n || data.low.size() != n || (withVolume && data.volume.size() != n)) {
+        std::cerr << "Mismatched column lengths for " << data.ticker << std::endl;
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+Macd macd(const std::vector<double>& prices, std::size_t fast, std::size_t slow, std::size_t signal) {
+    Macd       result;
+    MacdKernel kernel(result, prices.size(), fast, slow, signal);
+    for (std::size_t i = 0; i < prices.size(); ++i) {
+        kernel.step(i, prices[i]);
+    }
+    return result;
+}
+
+BollingerBands bollinger(const std::vector<double>& prices, std::size_t window, double width) {
+    BollingerBands  result;
+    BollingerKernel kernel(result, prices.size(), window, width);
+    for (std::size_t i = 0; i < prices.size(); ++i) {
+        kernel.step(i, prices[i]);
+    }
+    return result;
+}
+
+std::vector<double> stddev(const std::vector<double>& prices, std::size_t window) {
+    return bollinger(prices, window).stddev;
+}
+
+std::vector<double> zscore(const std::vector<double>& prices, std::size_t window) {
+    return bollinger(prices, window).zscore;
+}
+
+std::vector<double> atr(const StockInfo& data, std::size_t period) {
+    std::vector<double> result;
+    if (!sameLength(data, false)) {
+        return result;
+    }
+
+    AtrKernel kernel(result, data.close.size(), period);
+    for (std::size_t i = 0; i < data.close.size(); ++i) {
+        kernel.step(i, data.high[i], data.low[i], data.close[i]);
+    }
+    return result;
+}
+
+DonchianChannel donchian(const StockInfo& data, std::size_t window) {
+    DonchianChannel result;
+    if (!sameLength(data, false)) {
+        return result;
+    }
+
+    DonchianKernel kernel(result, data.close.size(), window);
+    for (std::size_t i = 0; i < data.close.size(); ++i) {
+        kernel.step(i, data.high[i], data.low[i]);
+    }
+    return result;
+}
+
+std::vector<double> obv(const StockInfo& data) {
+    std::vector<double> result;
+    if (data.volume.size() != data.close.size()) {
+        std::cerr << "Mismatched column lengths for " << data.ticker << std::endl;
+        return result;
+    }
+
+    ObvKernel kernel(result, data.close.size());
+    for (std::size_t i = 0; i < data.close.size(); ++i) {
+        kernel.step(i, data.close[i], data.volume[i]);
+    }
+    return result;
+}
+
+Features computeFeatures(const StockInfo& data, const FeatureConfig& config) {
+    Features features;
+    if (!sameLength(data, true)) {
+        return features;
+    }
+
+    const std::size_t n = data.close.size();
+
+    StateKernel<SmaState> sma(features.sma, n, config.smaWindow);
+    StateKernel<EmaState> ema(features.ema, n, config.emaPeriod);
+    StateKernel<RsiState> rsi(features.rsi, n, config.rsiPeriod);
+    MacdKernel            macd(features.macd, n, config.macdFast, config.macdSlow, config.macdSignal);
+    BollingerKernel       bollinger(features.bollinger, n, config.bollingerWindow, config.bollingerWidth);
+    AtrKernel             atr(features.atr, n, config.atrPeriod);
+    DonchianKernel        donchian(features.donchian, n, config.donchianWindow);
+    ObvKernel             obv(features.obv, n);
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const double close = data.close[i];
+        const double high  = data.high[i];
+        const double low   = data.low[i];
+
+        sma.step(i, close);
+        ema.step(i, close);
+        rsi.step(i, close);
+        macd.step(i, close);
+        bollinger.step(i, close);
+        atr.step(i, high, low, close);
+        donchian.step(i, high, low);
+        obv.step(i, close, data.volume[i]);
+    }
+
+    return features;
+}
+
+}  // namespace indicator
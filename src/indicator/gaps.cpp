@@ -0,0 +1,215 @@
+#include "indicator/gaps.hpp"
+
+#include <cmath>
+#include <limits>
+
+#include "indicator.hpp"
+#include "indicator/state.hpp"
+
+namespace indicator {
+
+namespace {
+
+constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+
+std::size_t firstValid(const std::vector<double>& values) {
+    std::size_t i = 0;
+    while (i < values.size() && std::isnan(values[i])) {
+        ++i;
+    }
+    return i;
+}
+
+/**
+ * @brief Run a pointer-form kernel (writing n - lag values for n inputs) under
+ *        `policy`, into a result aligned to `values`.
+ */
+template <typename Kernel>
+std::vector<double> aligned(const std::vector<double>& values, std::size_t lag, GapPolicy policy, Kernel kernel) {
+    const std::size_t   n = values.size();
+    std::vector<double> out(n, kNaN);
+
+    const std::size_t gaps = gapCount(values);
+    if (gaps == 0) {
+        if (n > lag) {
+            kernel(values.data(), n, out.data() + lag);
+        }
+        return out;
+    }
+
+    switch (policy) {
+    case GapPolicy::Propagate: {
+        // Each run of valid bars is an independent series, read in place
+        std::size_t begin = firstValid(values);
+        while (begin < n) {
+            std::size_t end = begin;
+            while (end < n && !std::isnan(values[end])) {
+                ++end;
+            }
+            if (end - begin > lag) {
+                kernel(values.data() + begin, end - begin, out.data() + begin + lag);
+            }
+            begin = end;
+            while (begin < n && std::isnan(values[begin])) {
+                ++begin;
+            }
+        }
+        break;
+    }
+    case GapPolicy::ForwardFill: {
+        const auto        filled = forwardFill(values);
+        const std::size_t first  = firstValid(values);
+        if (n - first > lag) {
+            kernel(filled.data() + first, n - first, out.data() + first + lag);
+        }
+        break;
+    }
+    case GapPolicy::Skip: {
+        std::vector<double> valid(n - gaps + 1);  // branch-free compaction may store a gap one past the end
+        std::size_t         m = 0;
+        for (const double value : values) {
+            valid[m] = value;
+            m += !std::isnan(value);
+        }
+        if (m <= lag) {
+            break;
+        }
+
+        // Compute over the valid bars into the front of out, then spread back to
+        // their bars from the end (a value only moves right, so nothing unread is overwritten)
+        kernel(valid.data(), m, out.data());
+        std::size_t k = m;
+        for (std::size_t i = n; i-- > 0;) {
+            if (std::isnan(values[i])) {
+                out[i] = kNaN;
+                continue;
+            }
+            --k;
+            out[i] = k >= lag ? out[k - lag] : kNaN;
+        }
+        break;
+    }
+    }
+    return out;
+}
+
+/* Pointer-form kernels over the streaming states (bit-identical to indicator.hpp) */
+
+template <typename State>
+struct StateKernel {
+    std::size_t window;
+
+    void operator()(const double* values, std::size_t n, double* out) const {
+        State state(window);
+        for (std::size_t i = 0; i < n; ++i) {
+            state.update(values[i]);
+            if (i + 1 >= window) {
+                out[i + 1 - window] = state.value();
+            }
+        }
+    }
+};
+
+}  // namespace
+
+std::size_t gapCount(const std::vector<double>& values) {
+    std::size_t count = 0;
+    for (const double value : values) {
+        count += value != value;  // branch-free, so the scan vectorizes
+    }
+    return count;
+}
+
+std::vector<double> forwardFill(const std::vector<double>& values) {
+    std::vector<double> filled(values);
+    for (std::size_t i = 1; i < filled.size(); ++i) {
+        if (std::isnan(filled[i])) {
+            filled[i] = filled[i - 1];
+        }
+    }
+    return filled;
+}
+
+std::vector<double> sma(const std::vector<double>& prices, std::size_t window, GapPolicy policy) {
+    if (window == 0) {
+        return std::vector<double>(prices.size(), kNaN);
+    }
+    return aligned(prices, window - 1, policy, [window](const double* p, std::size_t n, double* out) {
+        detail::sma(p, n, window, out);
+    });
+}
+
+std::vector<double> ema(const std::vector<double>& prices, std::size_t period, GapPolicy policy) {
+    if (period == 0) {
+        return std::vector<double>(prices.size(), kNaN);
+    }
+    return aligned(prices, period - 1, policy, StateKernel<EmaState>{period});
+}
+
+std::vector<double> rsi(const std::vector<double>& prices, std::size_t period, GapPolicy policy) {
+    if (period == 0) {
+        return std::vector<double>(prices.size(), kNaN);
+    }
+    return aligned(prices, period, policy, [period](const double* p, std::size_t n, double* out) {
+        detail::rsi(p, n, period, out);
+    });
+}
+
+std::vector<double> variance(const std::vector<double>& prices, std::size_t window, GapPolicy policy) {
+    if (window == 0) {
+        return std::vector<double>(prices.size(), kNaN);
+    }
+    return aligned(prices, window - 1, policy, StateKernel<VarianceState>{window});
+}
+
+std::vector<double> rollingMax(const std::vector<double>& values, std::size_t window, GapPolicy policy) {
+    if (window == 0) {
+        return std::vector<double>(values.size(), kNaN);
+    }
+    return aligned(values, window - 1, policy, StateKernel<RollingMaxState>{window});
+}
+
+std::vector<double> rollingMin(const std::vector<double>& values, std::size_t window, GapPolicy policy) {
+    if (window == 0) {
+        return std::vector<double>(values.size(), kNaN);
+    }
+    return aligned(values, window - 1, policy, StateKernel<RollingMinState>{window});
+}
+
+void smaInto(const std::vector<double>& prices, std::size_t window, GapPolicy policy, std::vector<double>& out) {
+    if (gapCount(prices) == 0) {
+        smaInto(prices, window, out);
+    } else {
+        out = sma(prices, window, policy);
+    }
+}
+
+void rsiInto(const std::vector<double>& prices, std::size_t period, GapPolicy policy, std::vector<double>& out) {
+    if (gapCount(prices) == 0) {
+        rsiInto(prices, period, out);
+    } else {
+        out = rsi(prices, period, policy);
+    }
+}
+
+void emaInto(const std::vector<double>& prices, std::size_t period, GapPolicy policy, std::vector<double>& out) {
+    if (gapCount(prices) == 0) {
+        emaInto(prices, period, out);
+    } else {
+        out = ema(prices, period, policy);
+    }
+}
+
+std::vector<double> returns(const std::vector<double>& prices, GapPolicy policy) {
+    return aligned(prices, 1, policy, [](const double* p, std::size_t n, double* out) {
+        detail::returns(p, n, out);
+    });
+}
+
+std::vector<double> logReturns(const std::vector<double>& prices, GapPolicy policy) {
+    return aligned(prices, 1, policy, [](const double* p, std::size_t n, double* out) {
+        detail::logReturns(p, n, out);
+    });
+}
+
+}  // namespace indicator
@@ -0,0 +1,163 @@
+#include "indicator/simd.hpp"
+
+#include <atomic>
+
+#include "indicator.hpp"
+#include "simd_kernels.hpp"
+
+namespace indicator::simd {
+
+namespace detail {
+
+namespace {
+
+/* The indicator.hpp kernels behind the size checks they leave to their callers,
+   so Isa::Scalar is bit-identical to the plain functions */
+
+void smaScalar(const double* prices, std::size_t n, std::size_t window, double* out) {
+    if (window == 0 || n < window) {
+        return;
+    }
+    ::indicator::detail::sma(prices, n, window, out);
+}
+
+void rsiScalar(const double* prices, std::size_t n, std::size_t period, double* out) {
+    if (period == 0 || n <= period) {
+        return;
+    }
+    ::indicator::detail::rsi(prices, n, period, out);
+}
+
+}  // namespace
+
+const Kernels kScalarKernels = {
+    &smaScalar, &rsiScalar, &::indicator::detail::returns, &::indicator::detail::logReturns};
+
+}  // namespace detail
+
+namespace {
+
+const detail::Kernels& kernelsFor(Isa isa) {
+    switch (isa) {
+#ifdef YFINANCE_SIMD_X86
+    case Isa::Avx512:
+        return detail::kAvx512Kernels;
+    case Isa::Avx2:
+        return detail::kAvx2Kernels;
+    case Isa::Sse2:
+        return detail::kSse2Kernels;
+#endif
+    default:
+        return detail::kScalarKernels;
+    }
+}
+
+Isa detect() {
+#ifdef YFINANCE_SIMD_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) {
+        return Isa::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2")) {
+        return Isa::Avx2;
+    }
+    if (__builtin_cpu_supports("sse2")) {
+        return Isa::Sse2;
+    }
+#endif
+    return Isa::Scalar;
+}
+
+std::atomic<Isa>& active() {
+    static std::atomic<Isa> isa{detectedIsa()};
+    return isa;
+}
+
+const detail::Kernels& kernels() {
+    return kernelsFor(active().load(std::memory_order_relaxed));
+}
+
+}  // namespace
+
+Isa detectedIsa() {
+    static const Isa isa = detect();
+    return isa;
+}
+
+Isa activeIsa() {
+    return active().load(std::memory_order_relaxed);
+}
+
+Isa setIsa(Isa isa) {
+    const Isa chosen = static_cast<int>(isa) <= static_cast<int>(detectedIsa()) ? isa : detectedIsa();
+    active().store(chosen, std::memory_order_relaxed);
+    return chosen;
+}
+
+const char* isaName(Isa isa) {
+    switch (isa) {
+    case Isa::Scalar:
+        return "scalar";
+    case Isa::Sse2:
+        return "sse2";
+    case Isa::Avx2:
+        return "avx2";
+    case Isa::Avx512:
+        return "avx512";
+    }
+    return "unknown";
+}
+
+std::vector<double> sma(const std::vector<double>& prices, std::size_t window) {
+    if (window == 0 || prices.size() < window) {
+        return {};
+    }
+    std::vector<double> result(prices.size() - window + 1);
+    kernels().sma(prices.data(), prices.size(), window, result.data());
+    return result;
+}
+
+std::vector<double> rsi(const std::vector<double>& prices, std::size_t period) {
+    if (period == 0 || prices.size() <= period) {
+        return {};
+    }
+    std::vector<double> result(prices.size() - period);
+    kernels().rsi(prices.data(), prices.size(), period, result.data());
+    return result;
+}
+
+std::vector<double> returns(const std::vector<double>& prices) {
+    if (prices.size() < 2) {
+        return {};
+    }
+    std::vector<double> result(prices.size() - 1);
+    kernels().returns(prices.data(), prices.size(), result.data());
+    return result;
+}
+
+std::vector<double> logReturns(const std::vector<double>& prices) {
+    if (prices.size() < 2) {
+        return {};
+    }
+    std::vector<double> result(prices.size() - 1);
+    kernels().logReturns(prices.data(), prices.size(), result.data());
+    return result;
+}
+
+void sma(const double* prices, std::size_t n, std::size_t window, double* out) {
+    kernels().sma(prices, n, window, out);
+}
+
+void rsi(const double* prices, std::size_t n, std::size_t period, double* out) {
+    kernels().rsi(prices, n, period, out);
+}
+
+void returns(const double* prices, std::size_t n, double* out) {
+    kernels().returns(prices, n, out);
+}
+
+void logReturns(const double* prices, std::size_t n, double* out) {
+    kernels().logReturns(prices, n, out);
+}
+
+}  // namespace indicator::simd
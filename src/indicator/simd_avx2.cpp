@@ -0,0 +1,65 @@
+#define YFINANCE_SIMD_KERNELS
+#include "simd_kernels.hpp"
+
+#include <immintrin.h>
+
+namespace {
+
+struct Avx2 {
+    using V = __m256d;
+    using M = __m256d;
+
+    static constexpr std::size_t kWidth = 4;
+
+    static V    loadu(const double* p) { return _mm256_loadu_pd(p); }
+    static void storeu(double* p, V v) { _mm256_storeu_pd(p, v); }
+    static V    set1(double x) { return _mm256_set1_pd(x); }
+    static V    zero() { return _mm256_setzero_pd(); }
+
+    static V add(V a, V b) { return _mm256_add_pd(a, b); }
+    static V sub(V a, V b) { return _mm256_sub_pd(a, b); }
+    static V mul(V a, V b) { return _mm256_mul_pd(a, b); }
+    static V div(V a, V b) { return _mm256_div_pd(a, b); }
+    static V max(V a, V b) { return _mm256_max_pd(a, b); }
+
+    static M    lt(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+    static M    gt(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_GT_OQ); }
+    static M    ge(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_GE_OQ); }
+    static M    le(V a, V b) { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+    static M    both(M a, M b) { return _mm256_and_pd(a, b); }
+    static V    select(M m, V t, V f) { return _mm256_blendv_pd(f, t, m); }
+    static bool all(M m) { return _mm256_movemask_pd(m) == 0xF; }
+
+    static V andBits(V a, V b) { return _mm256_and_pd(a, b); }
+    static V orBits(V a, V b) { return _mm256_or_pd(a, b); }
+    static V srl52(V v) { return _mm256_castsi256_pd(_mm256_srli_epi64(_mm256_castpd_si256(v), 52)); }
+
+    template <int K>
+    static V shift(V v) {
+        static_assert(K == 1 || K == 2, "AVX2 registers hold four lanes");
+        if constexpr (K == 1) {
+            // [v0, v0, v1, v2] with lane 0 cleared
+            return _mm256_blend_pd(_mm256_permute4x64_pd(v, _MM_SHUFFLE(2, 1, 0, 0)), _mm256_setzero_pd(), 0x1);
+        } else {
+            return _mm256_permute2f128_pd(v, v, 0x08);  // [0, 0, v0, v1]
+        }
+    }
+
+    static V      broadcastLast(V v) { return _mm256_permute4x64_pd(v, _MM_SHUFFLE(3, 3, 3, 3)); }
+    static double lastLane(V v) {
+        const __m128d high = _mm256_extractf128_pd(v, 1);
+        return _mm_cvtsd_f64(_mm_unpackhi_pd(high, high));
+    }
+    static double hsum(V v) {
+        const __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+        return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+    }
+};
+
+}  // namespace
+
+namespace indicator::simd::detail {
+
+const Kernels kAvx2Kernels = makeKernels<Avx2>();
+
+}  // namespace indicator::simd::detail
@@ -0,0 +1,63 @@
+#define YFINANCE_SIMD_KERNELS
+#include "simd_kernels.hpp"
+
+#include <immintrin.h>
+
+namespace {
+
+/* AVX-512F only (no DQ): bitwise ops go through the integer domain */
+struct Avx512 {
+    using V = __m512d;
+    using M = __mmask8;
+
+    static constexpr std::size_t kWidth = 8;
+
+    static V    loadu(const double* p) { return _mm512_loadu_pd(p); }
+    static void storeu(double* p, V v) { _mm512_storeu_pd(p, v); }
+    static V    set1(double x) { return _mm512_set1_pd(x); }
+    static V    zero() { return _mm512_setzero_pd(); }
+
+    static V add(V a, V b) { return _mm512_add_pd(a, b); }
+    static V sub(V a, V b) { return _mm512_sub_pd(a, b); }
+    static V mul(V a, V b) { return _mm512_mul_pd(a, b); }
+    static V div(V a, V b) { return _mm512_div_pd(a, b); }
+    static V max(V a, V b) { return _mm512_max_pd(a, b); }
+
+    static M    lt(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+    static M    gt(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_GT_OQ); }
+    static M    ge(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_GE_OQ); }
+    static M    le(V a, V b) { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+    static M    both(M a, M b) { return static_cast<M>(a & b); }
+    static V    select(M m, V t, V f) { return _mm512_mask_blend_pd(m, f, t); }
+    static bool all(M m) { return m == 0xFF; }
+
+    static V andBits(V a, V b) {
+        return _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(a), _mm512_castpd_si512(b)));
+    }
+    static V orBits(V a, V b) {
+        return _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(a), _mm512_castpd_si512(b)));
+    }
+    static V srl52(V v) { return _mm512_castsi512_pd(_mm512_srli_epi64(_mm512_castpd_si512(v), 52)); }
+
+    template <int K>
+    static V shift(V v) {
+        static_assert(K == 1 || K == 2 || K == 4, "AVX-512 registers hold eight lanes");
+        // Lanes [zero : v] shifted right by 8 - K: lane i becomes v[i - K], or 0 for i < K
+        return _mm512_castsi512_pd(_mm512_alignr_epi64(_mm512_castpd_si512(v), _mm512_setzero_si512(), 8 - K));
+    }
+
+    static V      broadcastLast(V v) { return _mm512_permutexvar_pd(_mm512_set1_epi64(7), v); }
+    static double lastLane(V v) {
+        const __m128d high = _mm256_extractf128_pd(_mm512_extractf64x4_pd(v, 1), 1);
+        return _mm_cvtsd_f64(_mm_unpackhi_pd(high, high));
+    }
+    static double hsum(V v) { return _mm512_reduce_add_pd(v); }
+};
+
+}  // namespace
+
+namespace indicator::simd::detail {
+
+const Kernels kAvx512Kernels = makeKernels<Avx512>();
+
+}  // namespace indicator::simd::detail
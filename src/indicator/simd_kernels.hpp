@@ -0,0 +1,303 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+/**
+ * @brief Kernel table shared by the per-ISA translation units and the dispatcher.
+ *        Internal to the library; the public interface is indicator/simd.hpp.
+ */
+namespace indicator::simd::detail {
+
+struct Kernels {
+    void (*sma)(const double* prices, std::size_t n, std::size_t window, double* out);
+    void (*rsi)(const double* prices, std::size_t n, std::size_t period, double* out);
+    void (*returns)(const double* prices, std::size_t n, double* out);
+    void (*logReturns)(const double* prices, std::size_t n, double* out);
+};
+
+extern const Kernels kScalarKernels;
+extern const Kernels kSse2Kernels;
+extern const Kernels kAvx2Kernels;
+extern const Kernels kAvx512Kernels;
+
+}  // namespace indicator::simd::detail
+
+#ifdef YFINANCE_SIMD_KERNELS
+
+/*
+ * Kernel templates, written once against an ISA "ops" struct O that each
+ * simd_<isa>.cpp defines before including this file with YFINANCE_SIMD_KERNELS.
+ *
+ * Everything here has internal linkage on purpose: the ISA files are compiled
+ * with different -m flags, and an inline function with external linkage would
+ * be merged across them by the linker, possibly keeping the AVX-512 copy for
+ * every caller. For the same reason, no std:: templates are used below.
+ *
+ * O provides: V (register), M (compare mask), kWidth, loadu, storeu, set1,
+ * zero, add, sub, mul, div, max, lt, gt, ge, le, both, select, all, andBits,
+ * orBits, srl52, shift<K> (move lanes up by K, zero fill), broadcastLast,
+ * lastLane, hsum.
+ */
+namespace {
+
+using indicator::simd::detail::Kernels;
+
+constexpr uint64_t kMantissaMask = 0x000FFFFFFFFFFFFFULL;
+constexpr uint64_t kOneBits      = 0x3FF0000000000000ULL;
+constexpr uint64_t kTwo52Bits    = 0x4330000000000000ULL;  // 2^52, for integer-to-double via OR
+constexpr double   kTwo52Bias    = 4503599627370496.0 + 1023.0;
+constexpr double   kSqrt2        = 1.4142135623730951;
+constexpr double   kLn2Hi        = 6.93147180369123816490e-01;  // fdlibm split of ln 2; ln2Hi * e is exact
+constexpr double   kLn2Lo        = 1.90821492927058770002e-10;
+constexpr double   kMinNormal    = 2.2250738585072014e-308;
+constexpr double   kMaxFinite    = 1.7976931348623157e+308;
+
+inline double maxZero(double x) {
+    return x > 0.0 ? x : 0.0;
+}
+
+inline double rsiValue(double avgGain, double avgLoss) {
+    return avgLoss < 1e-12 ? 100.0 : 100.0 - (100.0 / (1.0 + avgGain / avgLoss));
+}
+
+template <class O>
+typename O::V fromBits(uint64_t bits) {
+    double d;
+    std::memcpy(&d, &bits, sizeof(d));
+    return O::set1(d);
+}
+
+/* Inclusive prefix sum within a register (Hillis-Steele: log2(width) shift-adds) */
+template <class O>
+typename O::V prefixSum(typename O::V v) {
+    v = O::add(v, O::template shift<1>(v));
+    if constexpr (O::kWidth > 2) {
+        v = O::add(v, O::template shift<2>(v));
+    }
+    if constexpr (O::kWidth > 4) {
+        v = O::add(v, O::template shift<4>(v));
+    }
+    return v;
+}
+
+/*
+ * Lane-local solution of y[i] = s * y[i - 1] + c[i] with y[-1] = 0:
+ * lane i becomes sum_k s^k c[i - k]. The same shift-add ladder with weights s, s^2, s^4.
+ */
+template <class O>
+typename O::V linearScan(typename O::V c, const typename O::V* weights) {
+    c = O::add(c, O::mul(weights[0], O::template shift<1>(c)));
+    if constexpr (O::kWidth > 2) {
+        c = O::add(c, O::mul(weights[1], O::template shift<2>(c)));
+    }
+    if constexpr (O::kWidth > 4) {
+        c = O::add(c, O::mul(weights[2], O::template shift<4>(c)));
+    }
+    return c;
+}
+
+template <class O>
+void smaKernel(const double* prices, std::size_t n, std::size_t window, double* out) {
+    constexpr std::size_t W = O::kWidth;
+    if (window == 0 || n < window) {
+        return;
+    }
+
+    const double divisor = static_cast<double>(window);
+    double       sum     = 0.0;
+    for (std::size_t i = 0; i < window; ++i) {
+        sum += prices[i];
+    }
+    out[0] = sum / divisor;
+
+    // sum[j] = sum[j - 1] + (p[j + window - 1] - p[j - 1]): the differences are independent,
+    // so only the carry between registers is serial
+    const std::size_t count = n - window + 1;
+    const auto        vdiv  = O::set1(divisor);
+    auto              carry = O::set1(sum);
+    std::size_t       j     = 1;
+    for (; j + W <= count; j += W) {
+        auto s = O::sub(O::loadu(prices + j + window - 1), O::loadu(prices + j - 1));
+        s      = O::add(prefixSum<O>(s), carry);
+        O::storeu(out + j, O::div(s, vdiv));
+        carry = O::broadcastLast(s);
+    }
+
+    sum = O::lastLane(carry);
+    for (; j < count; ++j) {
+        sum += prices[j + window - 1] - prices[j - 1];
+        out[j] = sum / divisor;
+    }
+}
+
+template <class O>
+void rsiKernel(const double* prices, std::size_t n, std::size_t period, double* out) {
+    constexpr std::size_t W = O::kWidth;
+    if (period == 0 || n <= period) {
+        return;
+    }
+
+    // Seed: mean gain/loss of the first `period` changes, split without branches
+    const auto  zero = O::zero();
+    auto        g    = zero;
+    auto        l    = zero;
+    std::size_t i    = 1;
+    for (; i + W <= period + 1; i += W) {
+        const auto change = O::sub(O::loadu(prices + i), O::loadu(prices + i - 1));
+        g                 = O::add(g, O::max(change, zero));
+        l                 = O::add(l, O::max(O::sub(zero, change), zero));
+    }
+    double avgGain = O::hsum(g);
+    double avgLoss = O::hsum(l);
+    for (; i <= period; ++i) {
+        const double change = prices[i] - prices[i - 1];
+        avgGain += maxZero(change);
+        avgLoss += maxZero(-change);
+    }
+    avgGain /= static_cast<double>(period);
+    avgLoss /= static_cast<double>(period);
+    out[0] = rsiValue(avgGain, avgLoss);
+
+    // Wilder smoothing avg = avg * s + x / period, solved W bars at a time:
+    // y = scan(x / period) + [s, s^2, ..., s^W] * y_prev
+    const double smooth = static_cast<double>(period - 1) / static_cast<double>(period);
+    const double inv    = 1.0 / static_cast<double>(period);
+
+    double powers[W];
+    powers[0] = smooth;
+    for (std::size_t k = 1; k < W; ++k) {
+        powers[k] = powers[k - 1] * smooth;
+    }
+    const typename O::V weights[3] = {O::set1(powers[0]), O::set1(powers[W > 1 ? 1 : 0]),
+                                      O::set1(powers[W > 3 ? 3 : 0])};
+    const auto          carryW     = O::loadu(powers);
+    const auto          vinv       = O::set1(inv);
+    const auto          hundred    = O::set1(100.0);
+    const auto          one        = O::set1(1.0);
+    const auto          epsilon    = O::set1(1e-12);
+
+    const std::size_t count    = n - period;
+    auto              prevGain = O::set1(avgGain);
+    auto              prevLoss = O::set1(avgLoss);
+    std::size_t       j        = 1;
+    for (; j + W <= count; j += W) {
+        const double* p      = prices + period + j;
+        const auto    change = O::sub(O::loadu(p), O::loadu(p - 1));
+        const auto    gain   = O::mul(O::max(change, zero), vinv);
+        const auto    loss   = O::mul(O::max(O::sub(zero, change), zero), vinv);
+
+        const auto yg = O::add(linearScan<O>(gain, weights), O::mul(carryW, prevGain));
+        const auto yl = O::add(linearScan<O>(loss, weights), O::mul(carryW, prevLoss));
+        prevGain      = O::broadcastLast(yg);
+        prevLoss      = O::broadcastLast(yl);
+
+        const auto value = O::sub(hundred, O::div(hundred, O::add(one, O::div(yg, yl))));
+        O::storeu(out + j, O::select(O::lt(yl, epsilon), hundred, value));
+    }
+
+    avgGain = O::lastLane(prevGain);
+    avgLoss = O::lastLane(prevLoss);
+    for (; j < count; ++j) {
+        const double change = prices[period + j] - prices[period + j - 1];
+        avgGain             = avgGain * smooth + maxZero(change) * inv;
+        avgLoss             = avgLoss * smooth + maxZero(-change) * inv;
+        out[j]              = rsiValue(avgGain, avgLoss);
+    }
+}
+
+template <class O>
+void returnsKernel(const double* prices, std::size_t n, double* out) {
+    constexpr std::size_t W = O::kWidth;
+    if (n < 2) {
+        return;
+    }
+
+    const auto  one = O::set1(1.0);
+    std::size_t i   = 0;
+    for (; i + W <= n - 1; i += W) {
+        O::storeu(out + i, O::sub(O::div(O::loadu(prices + i + 1), O::loadu(prices + i)), one));
+    }
+    for (; i < n - 1; ++i) {
+        out[i] = prices[i + 1] / prices[i] - 1.0;
+    }
+}
+
+/*
+ * log(x) for positive, normal, finite x: x = m * 2^e with m in [sqrt(1/2), sqrt(2)),
+ * log(m) = 2 atanh(f) = 2 (f + f^3/3 + f^5/5 + ...), f = (m - 1) / (m + 1), |f| <= 0.172.
+ * Twelve odd terms reach double precision on that interval.
+ */
+template <class O>
+typename O::V logPositive(typename O::V x) {
+    const auto one      = O::set1(1.0);
+    const auto exponent = O::srl52(x);  // biased exponent as an integer in the low bits
+    auto       m        = O::orBits(O::andBits(x, fromBits<O>(kMantissaMask)), fromBits<O>(kOneBits));
+    auto       e        = O::sub(O::orBits(exponent, fromBits<O>(kTwo52Bits)), O::set1(kTwo52Bias));
+
+    const auto high = O::gt(m, O::set1(kSqrt2));
+    m               = O::select(high, O::mul(m, O::set1(0.5)), m);
+    e               = O::add(e, O::select(high, one, O::zero()));
+
+    const auto f  = O::div(O::sub(m, one), O::add(m, one));
+    const auto z  = O::mul(f, f);
+    const auto z2 = O::mul(z, z);
+    const auto z4 = O::mul(z2, z2);
+    const auto z8 = O::mul(z4, z4);
+
+    // p = 1/3 + z/5 + z^2/7 + ... + z^10/23 by Estrin's scheme: a shallow tree instead of a serial chain
+    auto term = [](typename O::V x, double a, double b) {
+        return O::add(O::set1(a), O::mul(x, O::set1(b)));
+    };
+    const auto q0 = term(z, 1.0 / 3.0, 1.0 / 5.0);
+    const auto q1 = term(z, 1.0 / 7.0, 1.0 / 9.0);
+    const auto q2 = term(z, 1.0 / 11.0, 1.0 / 13.0);
+    const auto q3 = term(z, 1.0 / 15.0, 1.0 / 17.0);
+    const auto q4 = term(z, 1.0 / 19.0, 1.0 / 21.0);
+    const auto r0 = O::add(q0, O::mul(q1, z2));
+    const auto r1 = O::add(q2, O::mul(q3, z2));
+    const auto r2 = O::add(q4, O::mul(O::set1(1.0 / 23.0), z2));
+    const auto p  = O::add(O::add(r0, O::mul(r1, z4)), O::mul(r2, z8));
+
+    // 2f + 2f * z * p keeps the leading term exact
+    const auto twoF = O::add(f, f);
+    const auto logM = O::add(twoF, O::mul(O::mul(twoF, z), p));
+    return O::add(O::mul(e, O::set1(kLn2Hi)), O::add(logM, O::mul(e, O::set1(kLn2Lo))));
+}
+
+template <class O>
+void logReturnsKernel(const double* prices, std::size_t n, double* out) {
+    constexpr std::size_t W = O::kWidth;
+    if (n < 2) {
+        return;
+    }
+
+    const auto  minNormal = O::set1(kMinNormal);
+    const auto  maxFinite = O::set1(kMaxFinite);
+    std::size_t i         = 0;
+    for (; i + W <= n - 1; i += W) {
+        const auto ratio = O::div(O::loadu(prices + i + 1), O::loadu(prices + i));
+        if (O::all(O::both(O::ge(ratio, minNormal), O::le(ratio, maxFinite)))) {
+            O::storeu(out + i, logPositive<O>(ratio));
+        } else {
+            // Zero, negative, subnormal, infinite or NaN ratios take libm's special cases
+            for (std::size_t k = i; k < i + W; ++k) {
+                out[k] = std::log(prices[k + 1] / prices[k]);
+            }
+        }
+    }
+    for (; i < n - 1; ++i) {
+        out[i] = std::log(prices[i + 1] / prices[i]);
+    }
+}
+
+template <class O>
+constexpr Kernels makeKernels() {
+    return {&smaKernel<O>, &rsiKernel<O>, &returnsKernel<O>, &logReturnsKernel<O>};
+}
+
+}  // namespace
+
+#endif  // YFINANCE_SIMD_KERNELS
@@ -0,0 +1,54 @@
+#define YFINANCE_SIMD_KERNELS
+#include "simd_kernels.hpp"
+
+#include <emmintrin.h>
+
+namespace {
+
+struct Sse2 {
+    using V = __m128d;
+    using M = __m128d;
+
+    static constexpr std::size_t kWidth = 2;
+
+    static V    loadu(const double* p) { return _mm_loadu_pd(p); }
+    static void storeu(double* p, V v) { _mm_storeu_pd(p, v); }
+    static V    set1(double x) { return _mm_set1_pd(x); }
+    static V    zero() { return _mm_setzero_pd(); }
+
+    static V add(V a, V b) { return _mm_add_pd(a, b); }
+    static V sub(V a, V b) { return _mm_sub_pd(a, b); }
+    static V mul(V a, V b) { return _mm_mul_pd(a, b); }
+    static V div(V a, V b) { return _mm_div_pd(a, b); }
+    static V max(V a, V b) { return _mm_max_pd(a, b); }
+
+    static M    lt(V a, V b) { return _mm_cmplt_pd(a, b); }
+    static M    gt(V a, V b) { return _mm_cmpgt_pd(a, b); }
+    static M    ge(V a, V b) { return _mm_cmpge_pd(a, b); }
+    static M    le(V a, V b) { return _mm_cmple_pd(a, b); }
+    static M    both(M a, M b) { return _mm_and_pd(a, b); }
+    static V    select(M m, V t, V f) { return _mm_or_pd(_mm_and_pd(m, t), _mm_andnot_pd(m, f)); }
+    static bool all(M m) { return _mm_movemask_pd(m) == 0x3; }
+
+    static V andBits(V a, V b) { return _mm_and_pd(a, b); }
+    static V orBits(V a, V b) { return _mm_or_pd(a, b); }
+    static V srl52(V v) { return _mm_castsi128_pd(_mm_srli_epi64(_mm_castpd_si128(v), 52)); }
+
+    template <int K>
+    static V shift(V v) {
+        static_assert(K == 1, "SSE2 registers hold two lanes");
+        return _mm_unpacklo_pd(_mm_setzero_pd(), v);  // [0, v0]
+    }
+
+    static V      broadcastLast(V v) { return _mm_unpackhi_pd(v, v); }
+    static double lastLane(V v) { return _mm_cvtsd_f64(_mm_unpackhi_pd(v, v)); }
+    static double hsum(V v) { return _mm_cvtsd_f64(_mm_add_sd(v, _mm_unpackhi_pd(v, v))); }
+};
+
+}  // namespace
+
+namespace indicator::simd::detail {
+
+const Kernels kSse2Kernels = makeKernels<Sse2>();
+
+}  // namespace indicator::simd::detail
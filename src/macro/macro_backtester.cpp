@@ -6,6 +6,35 @@
 #include <iostream>
 #include <numeric>
 
+#include "indicator/drawdown.hpp"
+
+namespace {
+
+/* Interned IDs of the asset-class keys, in Allocation field order */
+struct AssetIds {
+    SymbolId stocks;
+    SymbolId gold;
+    SymbolId metals;
+    SymbolId bonds;
+    SymbolId cash;
+};
+
+const AssetIds& assetIds() {
+    static const AssetIds ids = [] {
+        auto&    table = SymbolTable::global();
+        AssetIds r;
+        r.stocks = table.intern("stocks");
+        r.gold   = table.intern("gold");
+        r.metals = table.intern("metals");
+        r.bonds  = table.intern("bonds");
+        r.cash   = table.intern("cash");
+        return r;
+    }();
+    return ids;
+}
+
+}  // namespace
+
 bool MacroBacktester::isRebalancePoint(size_t monthIndex, const std::string& frequency) {
     if (frequency == "m") {
         return true;
@@ -24,6 +53,27 @@ MacroBacktestResult MacroBacktester::run(const nlohmann::json&
                                          const std::map<std::string, std::vector<double>>&             assetReturns,
                                          const std::vector<std::string>& dates, const std::string& frequency,
                                          double initialCapital) {
+    return run(config, MacroScorer::toSeriesTable(fredData), toReturnTable(assetReturns), dates, frequency,
+               initialCapital);
+}
+
+AssetReturnTable MacroBacktester::toReturnTable(const std::map<std::string, std::vector<double>>& assetReturns) {
+    auto& symbols = SymbolTable::global();
+
+    AssetReturnTable table;
+    for (const auto& [key, returns] : assetReturns) {
+        const SymbolId sym = symbols.intern(key);
+        if (sym >= table.size()) {
+            table.resize(sym + 1);
+        }
+        table[sym] = returns;
+    }
+    return table;
+}
+
+MacroBacktestResult MacroBacktester::run(const nlohmann::json& config, const FredSeriesTable& fredData,
+                                         const AssetReturnTable& assetReturns, const std::vector<std::string>& dates,
+                                         const std::string& frequency, double initialCapital) {
     MacroBacktestResult result;
     result.frequency      = frequency;
     result.initialCapital = initialCapital;
@@ -40,7 +90,7 @@ MacroBacktestResult MacroBacktester::run(const nlohmann::json&
 
     // Find the minimum data length across FRED series to avoid out-of-bounds
     size_t fredMinLen = std::numeric_limits<size_t>::max();
-    for (const auto& [id, series] : fredData) {
+    for (const auto& series : fredData) {
         if (series) {
             fredMinLen = std::min(fredMinLen, series->values.size());
         }
@@ -56,6 +106,8 @@ MacroBacktestResult MacroBacktester::run(const nlohmann::json&
     Regime prevRegime        = Regime::Slowdown;
     bool   hadFirstRebalance = false;
 
+    const auto& ids = assetIds();
+
     for (size_t i = 0; i < months; ++i) {
         // Rebalance at rebalancing points
         if (isRebalancePoint(i, frequency)) {
@@ -88,21 +140,21 @@ MacroBacktestResult MacroBacktester::run(const nlohmann::json&
         // Apply monthly returns with current allocation
         double portfolioReturn = 0.0;
 
-        auto applyAsset = [&](const std::string& key, double weight) {
-            if (weight <= 0.0 || assetReturns.find(key) == assetReturns.end()) {
+        auto applyAsset = [&](SymbolId id, double weight) {
+            if (weight <= 0.0 || id >= assetReturns.size()) {
                 return;
             }
-            const auto& returns = assetReturns.at(key);
+            const auto& returns = assetReturns[id];
             if (i < returns.size()) {
                 portfolioReturn += (weight / 100.0) * returns[i];
             }
         };
 
-        applyAsset("stocks", currentAlloc.stocks);
-        applyAsset("gold", currentAlloc.gold);
-        applyAsset("metals", currentAlloc.metals);
-        applyAsset("bonds", currentAlloc.bonds);
-        applyAsset("cash", currentAlloc.cash);
+        applyAsset(ids.stocks, currentAlloc.stocks);
+        applyAsset(ids.gold, currentAlloc.gold);
+        applyAsset(ids.metals, currentAlloc.metals);
+        applyAsset(ids.bonds, currentAlloc.bonds);
+        applyAsset(ids.cash, currentAlloc.cash);
 
         equity *= (1.0 + portfolioReturn);
         equityCurve.push_back(equity);
@@ -123,16 +175,7 @@ MacroBacktestResult MacroBacktester::run(const nlohmann::json&
     }
 
     // Max Drawdown
-    {
-        double peak  = equityCurve[0];
-        double maxDD = 0.0;
-        for (const auto& eq : equityCurve) {
-            peak            = std::max(peak, eq);
-            const double dd = (eq - peak) / peak * 100.0;
-            maxDD           = std::min(maxDD, dd);
-        }
-        result.maxDrawdownPct = maxDD;
-    }
+    result.maxDrawdownPct = indicator::maxDrawdownPct(equityCurve);
 
     // Sharpe Ratio (annualized from monthly returns)
     {
@@ -190,16 +233,7 @@ MacroBacktestResult MacroBacktester::computeBenchmark(const std::vector<double>&
     }
 
     // MDD
-    {
-        double peak  = equityCurve[0];
-        double maxDD = 0.0;
-        for (const auto& eq : equityCurve) {
-            peak            = std::max(peak, eq);
-            const double dd = (eq - peak) / peak * 100.0;
-            maxDD           = std::min(maxDD, dd);
-        }
-        result.maxDrawdownPct = maxDD;
-    }
+    result.maxDrawdownPct = indicator::maxDrawdownPct(equityCurve);
 
     // Sharpe
     {
@@ -53,49 +53,93 @@ struct DataAccessor {
     GetChange getChange;
 };
 
-double scoreGrowth(const std::map<std::string, std::shared_ptr<FredSeriesInfo>>& data, const DataAccessor& acc) {
-    double s = 50.0;
+/* Interned IDs of the series the scores read, resolved once per process */
+struct SeriesIds {
+    SymbolId unrate;
+    SymbolId payems;
+    SymbolId indpro;
+    SymbolId cpiaucsl;
+    SymbolId cpilfesl;
+    SymbolId pcepi;
+    SymbolId m2real;
+    SymbolId wm2ns;
+    SymbolId fedfunds;
+    SymbolId umcsent;
+    SymbolId t10y2y;
+    SymbolId bamlh0a0hym2;
+};
+
+const SeriesIds& seriesIds() {
+    static const SeriesIds ids = [] {
+        auto&     table = SymbolTable::global();
+        SeriesIds r;
+        r.unrate       = table.intern("UNRATE");
+        r.payems       = table.intern("PAYEMS");
+        r.indpro       = table.intern("INDPRO");
+        r.cpiaucsl     = table.intern("CPIAUCSL");
+        r.cpilfesl     = table.intern("CPILFESL");
+        r.pcepi        = table.intern("PCEPI");
+        r.m2real       = table.intern("M2REAL");
+        r.wm2ns        = table.intern("WM2NS");
+        r.fedfunds     = table.intern("FEDFUNDS");
+        r.umcsent      = table.intern("UMCSENT");
+        r.t10y2y       = table.intern("T10Y2Y");
+        r.bamlh0a0hym2 = table.intern("BAMLH0A0HYM2");
+        return r;
+    }();
+    return ids;
+}
+
+/* Series slot of an ID, or nullptr if the table has no such series */
+const std::shared_ptr<FredSeriesInfo>* lookup(const FredSeriesTable& data, SymbolId id) {
+    return (id < data.size() && data[id]) ? &data[id] : nullptr;
+}
 
-    if (data.count("UNRATE")) {
-        double roc = acc.getChange(data.at("UNRATE"));
-        double lvl = acc.getValue(data.at("UNRATE"));
+double scoreGrowth(const FredSeriesTable& data, const DataAccessor& acc) {
+    const auto& ids = seriesIds();
+    double      s   = 50.0;
+
+    if (const auto* series = lookup(data, ids.unrate)) {
+        double roc = acc.getChange(*series);
+        double lvl = acc.getValue(*series);
         s += (-roc) * 100.0;
         s += (5.0 - lvl) * 5.0;
     }
 
-    if (data.count("PAYEMS")) {
-        double roc = acc.getChange(data.at("PAYEMS"));
+    if (const auto* series = lookup(data, ids.payems)) {
+        double roc = acc.getChange(*series);
         s += (roc / 200.0) * 10.0;
     }
 
-    if (data.count("INDPRO")) {
-        double roc = acc.getChange(data.at("INDPRO"));
+    if (const auto* series = lookup(data, ids.indpro)) {
+        double roc = acc.getChange(*series);
         s += roc * 5.0;
     }
 
     return MacroScorer::clamp(s);
 }
 
-double scoreInflation(const std::map<std::string, std::shared_ptr<FredSeriesInfo>>& data, const DataAccessor& acc) {
-    double s = 50.0;
+double scoreInflation(const FredSeriesTable& data, const DataAccessor& acc) {
+    const auto& ids = seriesIds();
+    double      s   = 50.0;
 
-    if (data.count("CPIAUCSL")) {
-        double roc    = acc.getChange(data.at("CPIAUCSL"));
-        double val    = acc.getValue(data.at("CPIAUCSL"));
+    if (const auto* series = lookup(data, ids.cpiaucsl)) {
+        double roc    = acc.getChange(*series);
+        double val    = acc.getValue(*series);
         double pctChg = (val > 0) ? (roc / val) * 100.0 * 12.0 : 0.0;
         s += (pctChg - 2.0) * 10.0;
     }
 
-    if (data.count("CPILFESL")) {
-        double roc    = acc.getChange(data.at("CPILFESL"));
-        double val    = acc.getValue(data.at("CPILFESL"));
+    if (const auto* series = lookup(data, ids.cpilfesl)) {
+        double roc    = acc.getChange(*series);
+        double val    = acc.getValue(*series);
         double pctChg = (val > 0) ? (roc / val) * 100.0 * 12.0 : 0.0;
         s += (pctChg - 2.0) * 8.0;
     }
 
-    if (data.count("PCEPI")) {
-        double roc    = acc.getChange(data.at("PCEPI"));
-        double val    = acc.getValue(data.at("PCEPI"));
+    if (const auto* series = lookup(data, ids.pcepi)) {
+        double roc    = acc.getChange(*series);
+        double val    = acc.getValue(*series);
         double pctChg = (val > 0) ? (roc / val) * 100.0 * 12.0 : 0.0;
         s += (pctChg - 2.0) * 7.0;
     }
@@ -103,43 +147,45 @@ double scoreInflation(const std::map<std::string, std::shared_ptr<FredSeriesInfo
     return MacroScorer::clamp(s);
 }
 
-double scoreLiquidity(const std::map<std::string, std::shared_ptr<FredSeriesInfo>>& data, const DataAccessor& acc) {
-    double s = 50.0;
+double scoreLiquidity(const FredSeriesTable& data, const DataAccessor& acc) {
+    const auto& ids = seriesIds();
+    double      s   = 50.0;
 
-    if (data.count("M2REAL")) {
-        double roc    = acc.getChange(data.at("M2REAL"));
-        double val    = acc.getValue(data.at("M2REAL"));
+    if (const auto* series = lookup(data, ids.m2real)) {
+        double roc    = acc.getChange(*series);
+        double val    = acc.getValue(*series);
         double pctChg = (val > 0) ? (roc / val) * 100.0 : 0.0;
         s += pctChg * 30.0;
     }
 
-    if (data.count("WM2NS")) {
-        double roc    = acc.getChange(data.at("WM2NS"));
-        double val    = acc.getValue(data.at("WM2NS"));
+    if (const auto* series = lookup(data, ids.wm2ns)) {
+        double roc    = acc.getChange(*series);
+        double val    = acc.getValue(*series);
         double pctChg = (val > 0) ? (roc / val) * 100.0 : 0.0;
         s += pctChg * 20.0;
     }
 
-    if (data.count("FEDFUNDS")) {
-        double rate = acc.getValue(data.at("FEDFUNDS"));
+    if (const auto* series = lookup(data, ids.fedfunds)) {
+        double rate = acc.getValue(*series);
         s += (3.0 - rate) * 5.0;
     }
 
     return MacroScorer::clamp(s);
 }
 
-double scoreSentiment(const std::map<std::string, std::shared_ptr<FredSeriesInfo>>& data, const DataAccessor& acc,
+double scoreSentiment(const FredSeriesTable& data, const DataAccessor& acc,
                       const std::shared_ptr<FearAndGreedInfo>& fng) {
-    double s = 50.0;
-    int    n = 0;
+    const auto& ids = seriesIds();
+    double      s   = 50.0;
+    int         n   = 0;
 
     if (fng) {
         s = fng->score;
         n++;
     }
 
-    if (data.count("UMCSENT")) {
-        double val   = acc.getValue(data.at("UMCSENT"));
+    if (const auto* series = lookup(data, ids.umcsent)) {
+        double val   = acc.getValue(*series);
         double normd = MacroScorer::clamp((val - 50.0) * (100.0 / 60.0));
         if (n > 0) {
             s = (s + normd) / 2.0;
@@ -151,16 +197,17 @@ double scoreSentiment(const std::map<std::string, std::shared_ptr<FredSeriesInfo
     return MacroScorer::clamp(s);
 }
 
-double scoreRisk(const std::map<std::string, std::shared_ptr<FredSeriesInfo>>& data, const DataAccessor& acc) {
-    double s = 50.0;
+double scoreRisk(const FredSeriesTable& data, const DataAccessor& acc) {
+    const auto& ids = seriesIds();
+    double      s   = 50.0;
 
-    if (data.count("T10Y2Y")) {
-        double spread = acc.getValue(data.at("T10Y2Y"));
+    if (const auto* series = lookup(data, ids.t10y2y)) {
+        double spread = acc.getValue(*series);
         s += (-spread) * 10.0;
     }
 
-    if (data.count("BAMLH0A0HYM2")) {
-        double spread = acc.getValue(data.at("BAMLH0A0HYM2"));
+    if (const auto* series = lookup(data, ids.bamlh0a0hym2)) {
+        double spread = acc.getValue(*series);
         s += (spread - 4.0) * 8.0;
     }
 
@@ -179,17 +226,23 @@ MacroScores MacroScorer::computeScores(const std::map<std::string, std::shared_p
         return MacroScorer::rateOfChange(s);
     };
 
+    const auto table = toSeriesTable(data);
+
     MacroScores scores;
-    scores.growth    = scoreGrowth(data, acc);
-    scores.inflation = scoreInflation(data, acc);
-    scores.liquidity = scoreLiquidity(data, acc);
-    scores.sentiment = scoreSentiment(data, acc, fng);
-    scores.risk      = scoreRisk(data, acc);
+    scores.growth    = scoreGrowth(table, acc);
+    scores.inflation = scoreInflation(table, acc);
+    scores.liquidity = scoreLiquidity(table, acc);
+    scores.sentiment = scoreSentiment(table, acc, fng);
+    scores.risk      = scoreRisk(table, acc);
     return scores;
 }
 
 MacroScores MacroScorer::computeScoresAt(const std::map<std::string, std::shared_ptr<FredSeriesInfo>>& data,
                                          size_t                                                        index) {
+    return computeScoresAt(toSeriesTable(data), index);
+}
+
+MacroScores MacroScorer::computeScoresAt(const FredSeriesTable& data, size_t index) {
     DataAccessor acc;
     acc.getValue = [index](const std::shared_ptr<FredSeriesInfo>& s) {
         return MacroScorer::valueAt(s, index);
@@ -207,6 +260,20 @@ MacroScores MacroScorer::computeScoresAt(const std::map<std::string, std::shared
     return scores;
 }
 
+FredSeriesTable MacroScorer::toSeriesTable(const std::map<std::string, std::shared_ptr<FredSeriesInfo>>& fredData) {
+    auto& symbols = SymbolTable::global();
+
+    FredSeriesTable table;
+    for (const auto& [id, series] : fredData) {
+        const SymbolId sym = symbols.intern(id);
+        if (sym >= table.size()) {
+            table.resize(sym + 1);
+        }
+        table[sym] = series;
+    }
+    return table;
+}
+
 double MacroScorer::computeComposite(const MacroScores& scores, const nlohmann::json& config) {
     if (!config.contains("scoring_weights")) {
         return 50.0;
@@ -0,0 +1,256 @@
+#include "macro/sweep_results.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <queue>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr char kMagic[8] = {'Y', 'F', 'S', 'W', 'E', 'E', 'P', '1'};
+
+struct FileHeader {
+    char     magic[8]   = {};
+    uint32_t recordSize = sizeof(SweepRecord);
+    uint32_t headerSize = 0;  // bytes before the first record, including the name tables
+};
+
+static_assert(sizeof(FileHeader) == 16, "FileHeader must stay 16 bytes for the on-disk format");
+
+void putNames(std::string& out, const std::vector<std::string>& names) {
+    const auto count = static_cast<uint32_t>(names.size());
+    out.append(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (const auto& name : names) {
+        const auto len = static_cast<uint32_t>(name.size());
+        out.append(reinterpret_cast<const char*>(&len), sizeof(len));
+        out += name;
+    }
+}
+
+bool getNames(const char*& p, const char* end, std::vector<std::string>& names) {
+    uint32_t count = 0;
+    if (end - p < static_cast<std::ptrdiff_t>(sizeof(count))) {
+        return false;
+    }
+    std::memcpy(&count, p, sizeof(count));
+    p += sizeof(count);
+
+    names.clear();
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t len = 0;
+        if (end - p < static_cast<std::ptrdiff_t>(sizeof(len))) {
+            return false;
+        }
+        std::memcpy(&len, p, sizeof(len));
+        p += sizeof(len);
+        if (end - p < static_cast<std::ptrdiff_t>(len)) {
+            return false;
+        }
+        names.emplace_back(p, len);
+        p += len;
+    }
+    return true;
+}
+
+}  // namespace
+
+SweepResultsWriter::SweepResultsWriter(const std::string& path, const std::vector<std::string>& portfolios,
+                                       const std::vector<std::string>& strategies,
+                                       const std::vector<std::string>& periods) {
+    std::string names;
+    putNames(names, portfolios);
+    putNames(names, strategies);
+    putNames(names, periods);
+
+    // Keep records 8-byte aligned in the mapped file
+    const std::size_t unpadded = sizeof(FileHeader) + names.size();
+    names.resize(names.size() + (8 - unpadded % 8) % 8, '\0');
+
+    FileHeader header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.headerSize = static_cast<uint32_t>(sizeof(FileHeader) + names.size());
+
+    file_ = std::fopen(path.c_str(), "wb");
+    if (!file_) {
+        std::cerr << "Sweep results error: cannot create " << path << ": " << std::strerror(errno) << std::endl;
+        return;
+    }
+
+    if (std::fwrite(&header, sizeof(header), 1, file_) != 1
+        || std::fwrite(names.data(), 1, names.size(), file_) != names.size()) {
+        std::cerr << "Sweep results error: cannot write " << path << std::endl;
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+}
+
+SweepResultsWriter::~SweepResultsWriter() {
+    if (file_) {
+        std::fclose(file_);
+    }
+}
+
+bool SweepResultsWriter::append(const SweepRecord& record) {
+    if (!file_ || std::fwrite(&record, sizeof(record), 1, file_) != 1) {
+        return false;
+    }
+    ++count_;
+    return true;
+}
+
+bool SweepResultsWriter::flush() {
+    return file_ && std::fflush(file_) == 0;
+}
+
+SweepResults::~SweepResults() {
+    if (base_) {
+        ::munmap(base_, length_);
+    }
+}
+
+SweepResults::SweepResults(SweepResults&& other) noexcept
+    : base_(other.base_)
+    , length_(other.length_)
+    , records_(other.records_)
+    , size_(other.size_)
+    , portfolios_(std::move(other.portfolios_))
+    , strategies_(std::move(other.strategies_))
+    , periods_(std::move(other.periods_)) {
+    other.base_    = nullptr;
+    other.length_  = 0;
+    other.records_ = nullptr;
+    other.size_    = 0;
+}
+
+SweepResults& SweepResults::operator=(SweepResults&& other) noexcept {
+    if (this != &other) {
+        if (base_) {
+            ::munmap(base_, length_);
+        }
+        base_          = other.base_;
+        length_        = other.length_;
+        records_       = other.records_;
+        size_          = other.size_;
+        portfolios_    = std::move(other.portfolios_);
+        strategies_    = std::move(other.strategies_);
+        periods_       = std::move(other.periods_);
+        other.base_    = nullptr;
+        other.length_  = 0;
+        other.records_ = nullptr;
+        other.size_    = 0;
+    }
+    return *this;
+}
+
+SweepResults SweepResults::open(const std::string& path) {
+    SweepResults view;
+
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return view;
+    }
+
+    struct stat st = {};
+    if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+        ::close(fd);
+        return view;
+    }
+
+    const auto length = static_cast<std::size_t>(st.st_size);
+    void*      base   = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        return view;
+    }
+    view.base_   = base;
+    view.length_ = length;
+
+    FileHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.recordSize != sizeof(SweepRecord)
+        || header.headerSize > length || header.headerSize % 8 != 0) {
+        std::cerr << "Sweep results error: " << path << " is not a results file" << std::endl;
+        return view;
+    }
+
+    const char* p   = static_cast<const char*>(base) + sizeof(FileHeader);
+    const char* end = static_cast<const char*>(base) + header.headerSize;
+    if (!getNames(p, end, view.portfolios_) || !getNames(p, end, view.strategies_)
+        || !getNames(p, end, view.periods_)) {
+        std::cerr << "Sweep results error: " << path << " has a corrupt header" << std::endl;
+        return view;
+    }
+
+    // A torn trailing record from an interrupted sweep is ignored
+    view.records_ = reinterpret_cast<const SweepRecord*>(static_cast<const char*>(base) + header.headerSize);
+    view.size_    = (length - header.headerSize) / sizeof(SweepRecord);
+    return view;
+}
+
+std::vector<SweepRecord> SweepResults::topK(std::size_t k, const std::function<double(const SweepRecord&)>& score,
+                                            const std::function<bool(const SweepRecord&)>& filter) const {
+    using Entry  = std::pair<double, std::size_t>;  // (score, record index)
+    auto greater = [](const Entry& a, const Entry& b) {
+        return a.first > b.first;
+    };
+
+    // Min-heap of the best k seen so far
+    std::priority_queue<Entry, std::vector<Entry>, decltype(greater)> heap(greater);
+    if (k == 0) {
+        return {};
+    }
+
+    for (std::size_t i = 0; i < size_; ++i) {
+        if (filter && !filter(records_[i])) {
+            continue;
+        }
+        const double s = score(records_[i]);
+        if (heap.size() < k) {
+            heap.emplace(s, i);
+        } else if (s > heap.top().first) {
+            heap.pop();
+            heap.emplace(s, i);
+        }
+    }
+
+    std::vector<SweepRecord> best(heap.size());
+    for (auto it = best.rbegin(); it != best.rend(); ++it) {
+        *it = records_[heap.top().second];
+        heap.pop();
+    }
+    return best;
+}
+
+std::vector<SweepSummary> SweepResults::summarize() const {
+    const std::size_t strategyCount = strategies_.size();
+
+    std::vector<SweepSummary> summaries(portfolios_.size() * strategyCount);
+    for (std::size_t i = 0; i < summaries.size(); ++i) {
+        summaries[i].portfolio = static_cast<uint32_t>(i / strategyCount);
+        summaries[i].strategy  = static_cast<uint32_t>(i % strategyCount);
+    }
+
+    for (std::size_t i = 0; i < size_; ++i) {
+        const auto& r = records_[i];
+        if (r.portfolio >= portfolios_.size() || r.strategy >= strategyCount) {
+            continue;  // benchmark cell
+        }
+        auto& s = summaries[r.portfolio * strategyCount + r.strategy];
+        s.avgCagr += r.cagr;
+        s.avgSharpe += r.sharpe;
+        s.worstMdd = std::min(s.worstMdd, r.mdd);
+    }
+
+    const auto periodCount = static_cast<double>(std::max<std::size_t>(periods_.size(), 1));
+    for (auto& s : summaries) {
+        s.avgCagr /= periodCount;
+        s.avgSharpe /= periodCount;
+    }
+    return summaries;
+}
@@ -0,0 +1,101 @@
+#include "panel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <queue>
+#include <tuple>
+
+Panel Panel::fromStocks(const std::vector<std::shared_ptr<StockInfo>>& stocks) {
+    std::vector<const StockInfo*> raw;
+    raw.reserve(stocks.size());
+    for (const auto& s : stocks) {
+        raw.push_back(s.get());
+    }
+    return fromStocks(raw);
+}
+
+Panel Panel::fromStocks(const std::vector<const StockInfo*>& stocks) {
+    Panel panel;
+    const std::size_t n = stocks.size();
+
+    panel.tickers_.reserve(n);
+    std::size_t total = 0;
+    for (const auto* s : stocks) {
+        panel.tickers_.push_back(s ? s->ticker : "");
+        total += s ? s->timestamps.size() : 0;
+    }
+
+    // 1. K-way merge of the sorted timestamp columns into a deduplicated axis.
+    using Head = std::tuple<int64_t, std::size_t, std::size_t>;  // (timestamp, stock, position)
+    std::priority_queue<Head, std::vector<Head>, std::greater<Head>> heap;
+    for (std::size_t k = 0; k < n; ++k) {
+        if (stocks[k] && !stocks[k]->timestamps.empty()) {
+            heap.emplace(stocks[k]->timestamps[0], k, 0);
+        }
+    }
+
+    panel.timestamps_.reserve(total / std::max<std::size_t>(n, 1));
+    while (!heap.empty()) {
+        const auto [ts, k, pos] = heap.top();
+        heap.pop();
+        if (panel.timestamps_.empty() || panel.timestamps_.back() != ts) {
+            panel.timestamps_.push_back(ts);
+        }
+        const auto& col = stocks[k]->timestamps;
+        if (pos + 1 < col.size()) {
+            heap.emplace(col[pos + 1], k, pos + 1);
+        }
+    }
+
+    // 2. Scatter each series into its column with a linear merge-join against the axis.
+    const std::size_t t = panel.timestamps_.size();
+    panel.words_        = (t + 63) / 64;
+    panel.closes_.assign(n * t, 0.0);
+    panel.returns_.assign(n * t, 0.0);
+    panel.valid_.assign(n * panel.words_, 0);
+
+    for (std::size_t k = 0; k < n; ++k) {
+        const auto* s = stocks[k];
+        if (!s) {
+            continue;
+        }
+
+        double*   closes  = panel.closes_.data() + k * t;
+        double*   returns = panel.returns_.data() + k * t;
+        uint64_t* valid   = panel.valid_.data() + k * panel.words_;
+
+        const std::size_t len  = std::min(s->timestamps.size(), s->close.size());
+        std::size_t       src  = 0;
+        double            last = 0.0;
+        bool              seen = false;
+
+        for (std::size_t row = 0; row < t; ++row) {
+            // Skip duplicate timestamps within one series (keep the first)
+            while (src < len && s->timestamps[src] < panel.timestamps_[row]) {
+                ++src;
+            }
+
+            // A bar with a non-finite close (a null bar, e.g. a halt) counts as missing
+            if (src < len && s->timestamps[src] == panel.timestamps_[row] && std::isfinite(s->close[src])) {
+                const double price = s->close[src++];
+                if (seen && last > 0.0) {
+                    returns[row] = price / last - 1.0;
+                }
+                closes[row] = price;
+                valid[row >> 6] |= uint64_t{1} << (row & 63);
+                last = price;
+                seen = true;
+            } else {
+                closes[row] = last;
+            }
+        }
+    }
+
+    return panel;
+}
+
+std::ptrdiff_t Panel::find(const std::string& ticker) const {
+    const auto it = std::find(tickers_.begin(), tickers_.end(), ticker);
+    return (it == tickers_.end()) ? -1 : static_cast<std::ptrdiff_t>(it - tickers_.begin());
+}
@@ -0,0 +1,113 @@
+#include "stock_info.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+#include "civil_date.hpp"
+
+/* Midnight UTC of a YYYY-MM-DD date, or false if malformed */
+static bool parseDay(const std::string& date, int64_t& out) {
+    int64_t days = 0;
+    if (!civil::parseDate(date, days)) {
+        return false;
+    }
+    out = civil::toTimestamp(days);
+    return true;
+}
+
+uint64_t StockInfo::nextVersion() {
+    static std::atomic<uint64_t> counter{0};
+    return counter.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+
+std::size_t StockInfo::indexOf(const std::string& date) const {
+    int64_t day = 0;
+    if (!parseDay(date, day)) {
+        return npos;
+    }
+
+    const auto i = lowerBound(day);
+    if (i == timestamps.size() || timestamps[i] >= day + civil::kSecondsPerDay) {
+        return npos;
+    }
+    return i;
+}
+
+std::pair<std::size_t, std::size_t> StockInfo::range(const std::string& startDate, const std::string& endDate) const {
+    int64_t start = 0;
+    int64_t end   = 0;
+    if (!parseDay(startDate, start) || !parseDay(endDate, end)) {
+        return {0, 0};
+    }
+    return range(start, end + civil::kSecondsPerDay);
+}
+
+/* out[i] = in[i] * factor[i] for the first n bars */
+static void scaleColumn(const std::vector<double>& in, const std::vector<double>& factor, std::size_t n,
+                        std::vector<double>& out) {
+    n = std::min(n, in.size());
+    out.resize(n);
+
+    const double* src = in.data();
+    const double* f   = factor.data();
+    double*       dst = out.data();
+    for (std::size_t i = 0; i < n; ++i) {
+        dst[i] = src[i] * f[i];
+    }
+}
+
+void StockInfo::adjust(AdjustMode mode) {
+    touch();
+    const std::size_t n = timestamps.size();
+
+    auto& factor = adjusted.factor;
+    factor.resize(n);
+
+    // Walk actions newest to oldest; bars [first, end) share the factor accumulated so far
+    std::size_t d = dividends.size();
+    std::size_t s = (mode == AdjustMode::SplitsAndDividends) ? splits.size() : 0;
+
+    const int64_t last = n > 0 ? timestamps.back() : 0;
+    while (d > 0 && dividends[d - 1].timestamp > last) {
+        --d;
+    }
+    while (s > 0 && splits[s - 1].timestamp > last) {
+        --s;
+    }
+
+    double      f   = 1.0;
+    std::size_t end = n;
+    while (d > 0 || s > 0) {
+        const bool    isSplit = (s > 0) && (d == 0 || splits[s - 1].timestamp > dividends[d - 1].timestamp);
+        const int64_t ts      = isSplit ? splits[s - 1].timestamp : dividends[d - 1].timestamp;
+
+        const std::size_t first = std::min(lowerBound(ts), end);
+        std::fill(factor.begin() + static_cast<std::ptrdiff_t>(first),
+                  factor.begin() + static_cast<std::ptrdiff_t>(end), f);
+        end = first;
+
+        if (isSplit) {
+            const auto& split = splits[--s];
+            if (split.numerator > 0.0 && split.denominator > 0.0) {
+                f *= split.denominator / split.numerator;
+            }
+        } else {
+            // Against the last valid close before the ex-date (a halt leaves NaN bars)
+            const auto& dividend = dividends[--d];
+            std::size_t prev     = std::min(first, close.size());
+            while (prev > 0 && std::isnan(close[prev - 1])) {
+                --prev;
+            }
+            if (prev > 0 && close[prev - 1] > 0.0) {
+                f *= 1.0 - dividend.amount / close[prev - 1];
+            }
+        }
+    }
+    std::fill(factor.begin(), factor.begin() + static_cast<std::ptrdiff_t>(end), f);
+
+    scaleColumn(open, factor, n, adjusted.open);
+    scaleColumn(high, factor, n, adjusted.high);
+    scaleColumn(low, factor, n, adjusted.low);
+    scaleColumn(close, factor, n, adjusted.close);
+}
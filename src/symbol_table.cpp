@@ -0,0 +1,45 @@
+#include "symbol_table.hpp"
+
+#include <mutex>
+
+SymbolTable& SymbolTable::global() {
+    static SymbolTable table;
+    return table;
+}
+
+SymbolId SymbolTable::intern(std::string_view name) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        const auto                          it = ids_.find(name);
+        if (it != ids_.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    const auto                          it = ids_.find(name);
+    if (it != ids_.end()) {
+        return it->second;
+    }
+
+    const auto id = static_cast<SymbolId>(names_.size());
+    names_.emplace_back(name);
+    ids_.emplace(names_.back(), id);
+    return id;
+}
+
+SymbolId SymbolTable::find(std::string_view name) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    const auto                          it = ids_.find(name);
+    return (it == ids_.end()) ? kInvalid : it->second;
+}
+
+std::string_view SymbolTable::name(SymbolId id) const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return (id < names_.size()) ? std::string_view(names_[id]) : std::string_view();
+}
+
+std::size_t SymbolTable::size() const {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return names_.size();
+}
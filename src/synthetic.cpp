@@ -0,0 +1,442 @@
+#include "synthetic.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "civil_date.hpp"
+
+namespace synthetic {
+
+namespace {
+
+constexpr std::size_t kBlock   = 256;      // draws per generated block
+constexpr std::size_t kChunk   = 1 << 16;  // bars per generateStock() chunk
+constexpr uint64_t    kGolden  = 0x9E3779B97F4A7C15ULL;
+constexpr uint64_t    kOneBits = 0x3FF0000000000000ULL;  // exponent of 1.0
+constexpr std::size_t kTickerW = 5;                      // digits in "SYN00000"
+
+uint64_t splitmix64(uint64_t& state) {
+    uint64_t z = (state += kGolden);
+    z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z          = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+inline uint64_t rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+/**
+ * @brief [0, 1) double from the top 52 bits: set them as the mantissa of a number in [1, 2).
+ *        Only integer ops and one subtract, so it vectorizes without AVX-512 conversions.
+ */
+inline double toUnit(uint64_t x) {
+    const uint64_t bits = kOneBits | (x >> 12);
+    double         d;
+    std::memcpy(&d, &bits, sizeof(d));
+    return d - 1.0;
+}
+
+/**
+ * @brief Layer tables of the 128-layer ziggurat for the standard normal (Marsaglia-Tsang, Doornik's variant).
+ *        About 99% of draws take the fast path: one compare and one multiply.
+ */
+struct Ziggurat {
+    static constexpr unsigned kLayers = 128;
+    static constexpr double   kR      = 3.442619855899;       // start of the tail
+    static constexpr double   kV      = 9.91256303526217e-3;  // area of each layer
+
+    double x[kLayers + 1];  // layer edges, x[1] = R, x[kLayers] = 0
+    double ratio[kLayers];  // x[i + 1] / x[i]
+
+    static const Ziggurat& instance() {
+        static const Ziggurat tables;
+        return tables;
+    }
+
+   private:
+    Ziggurat() {
+        double f = std::exp(-0.5 * kR * kR);
+
+        x[0]       = kV / f;  // base layer: rectangle plus tail
+        x[1]       = kR;
+        x[kLayers] = 0.0;
+        for (unsigned i = 2; i < kLayers; ++i) {
+            x[i] = std::sqrt(-2.0 * std::log(kV / x[i - 1] + f));
+            f    = std::exp(-0.5 * x[i] * x[i]);
+        }
+        for (unsigned i = 0; i < kLayers; ++i) {
+            ratio[i] = x[i + 1] / x[i];
+        }
+    }
+};
+
+}  // namespace
+
+/* ---- Rng ---- */
+
+Rng::Rng(uint64_t seed) {
+    uint64_t state = seed;
+    for (auto& word : s_) {
+        for (auto& lane : word) {
+            lane = splitmix64(state);
+        }
+    }
+}
+
+uint64_t Rng::next() {
+    const std::size_t l      = lane_;
+    const uint64_t    result = s_[0][l] + s_[3][l];
+    const uint64_t    t      = s_[1][l] << 17;
+    s_[2][l] ^= s_[0][l];
+    s_[3][l] ^= s_[1][l];
+    s_[1][l] ^= s_[2][l];
+    s_[0][l] ^= s_[3][l];
+    s_[2][l] ^= t;
+    s_[3][l] = rotl(s_[3][l], 45);
+    lane_    = (lane_ + 1) % kLanes;
+    return result;
+}
+
+double Rng::uniform() {
+    return toUnit(next());
+}
+
+void Rng::fillBits(uint64_t* out, std::size_t n) {
+    uint64_t s0[kLanes], s1[kLanes], s2[kLanes], s3[kLanes];
+    std::memcpy(s0, s_[0], sizeof(s0));
+    std::memcpy(s1, s_[1], sizeof(s1));
+    std::memcpy(s2, s_[2], sizeof(s2));
+    std::memcpy(s3, s_[3], sizeof(s3));
+
+    std::size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+        for (std::size_t l = 0; l < kLanes; ++l) {
+            out[i + l]       = s0[l] + s3[l];
+            const uint64_t t = s1[l] << 17;
+            s2[l] ^= s0[l];
+            s3[l] ^= s1[l];
+            s1[l] ^= s2[l];
+            s0[l] ^= s3[l];
+            s2[l] ^= t;
+            s3[l] = rotl(s3[l], 45);
+        }
+    }
+
+    std::memcpy(s_[0], s0, sizeof(s0));
+    std::memcpy(s_[1], s1, sizeof(s1));
+    std::memcpy(s_[2], s2, sizeof(s2));
+    std::memcpy(s_[3], s3, sizeof(s3));
+
+    for (; i < n; ++i) {
+        out[i] = next();
+    }
+}
+
+void Rng::fillUniform(double* out, std::size_t n) {
+    uint64_t bits[kBlock];
+    for (std::size_t done = 0; done < n;) {
+        const std::size_t m = std::min(kBlock, n - done);
+        fillBits(bits, m);
+        for (std::size_t i = 0; i < m; ++i) {
+            out[done + i] = toUnit(bits[i]);
+        }
+        done += m;
+    }
+}
+
+void Rng::fillNormal(double* out, std::size_t n) {
+    const auto& zig = Ziggurat::instance();
+
+    uint64_t bits[kBlock];
+    for (std::size_t done = 0; done < n;) {
+        const std::size_t m = std::min(kBlock, n - done);
+        fillBits(bits, m);
+        for (std::size_t i = 0; i < m; ++i) {
+            // Top 52 bits give u in [-1, 1), bits 5..11 the layer (the low bits of xoshiro256+ are weak)
+            const double   u     = 2.0 * toUnit(bits[i]) - 1.0;
+            const unsigned layer = static_cast<unsigned>(bits[i] >> 5) & (Ziggurat::kLayers - 1);
+            out[done + i] = std::fabs(u) < zig.ratio[layer] ? u * zig.x[layer] : slowNormal(u, layer);
+        }
+        done += m;
+    }
+}
+
+double Rng::slowNormal(double u, unsigned layer) {
+    const auto& zig = Ziggurat::instance();
+    for (;;) {
+        if (std::fabs(u) < zig.ratio[layer]) {
+            return u * zig.x[layer];
+        }
+        if (layer == 0) {
+            // Base layer: sample the tail beyond R (Marsaglia's method)
+            double x, y;
+            do {
+                x = std::log(1.0 - uniform()) / Ziggurat::kR;
+                y = std::log(1.0 - uniform());
+            } while (-2.0 * y < x * x);
+            return u < 0.0 ? x - Ziggurat::kR : Ziggurat::kR - x;
+        }
+
+        const double x  = u * zig.x[layer];
+        const double f0 = std::exp(-0.5 * (zig.x[layer] * zig.x[layer] - x * x));
+        const double f1 = std::exp(-0.5 * (zig.x[layer + 1] * zig.x[layer + 1] - x * x));
+        if (f1 + uniform() * (f0 - f1) < 1.0) {
+            return x;
+        }
+
+        const uint64_t bits = next();
+        u                   = 2.0 * toUnit(bits) - 1.0;
+        layer               = static_cast<unsigned>(bits >> 5) & (Ziggurat::kLayers - 1);
+    }
+}
+
+/* ---- Prices ---- */
+
+PriceGenerator::PriceGenerator(std::string ticker, const PriceModel& model, uint64_t seed)
+    : ticker_(std::move(ticker))
+    , model_(model)
+    , rng_(seed)
+    , close_(model.initialPrice)
+    , timestamp_(model.startTimestamp) {}
+
+std::size_t PriceGenerator::next(StockInfo& out, std::size_t steps) {
+    out.touch();
+    const double dt        = 1.0 / model_.barsPerYear;
+    const double mu        = (model_.drift - 0.5 * model_.volatility * model_.volatility) * dt;
+    const double sigma     = model_.volatility * std::sqrt(dt);
+    const double jumpProb  = model_.jumpIntensity * dt;
+    const bool   hasJumps  = jumpProb > 0.0;
+    const double wickScale = 0.5 * sigma;
+
+    // normals_: [diffusion | volume | jump size]
+    // uniforms_: [high wick | low wick | missing | jump occurrence]
+    normals_.resize((hasJumps ? 3 : 2) * steps);
+    uniforms_.resize(4 * steps);
+    rng_.fillNormal(normals_.data(), normals_.size());
+    rng_.fillUniform(uniforms_.data(), (model_.missingRate > 0.0 ? 3 : 2) * steps);
+
+    double*       growth   = normals_.data();
+    const double* volumeZ  = normals_.data() + steps;
+    const double* highU    = uniforms_.data();
+    const double* lowU     = uniforms_.data() + steps;
+    const double* missingU = uniforms_.data() + 2 * steps;
+    double*       jumpU    = uniforms_.data() + 3 * steps;
+
+    if (hasJumps) {
+        rng_.fillUniform(jumpU, steps);
+        const double* jumpZ = normals_.data() + 2 * steps;
+        for (std::size_t i = 0; i < steps; ++i) {
+            const double jump = jumpU[i] < jumpProb ? model_.jumpMean + model_.jumpStdDev * jumpZ[i] : 0.0;
+            growth[i]         = mu + sigma * growth[i] + jump;
+        }
+    } else {
+        for (std::size_t i = 0; i < steps; ++i) {
+            growth[i] = mu + sigma * growth[i];
+        }
+    }
+    for (std::size_t i = 0; i < steps; ++i) {
+        growth[i] = std::exp(growth[i]);
+    }
+
+    out.ticker             = ticker_;
+    out.currency           = "USD";
+    out.exchangeName       = "SYNTHETIC";
+    out.instrumentType     = "EQUITY";
+    out.timezone           = "UTC";
+    out.firstTradeDate     = model_.startTimestamp;
+    out.gmtoffset          = 0;
+    out.chartPreviousClose = close_;
+    out.timestamps.resize(steps);
+    out.open.resize(steps);
+    out.high.resize(steps);
+    out.low.resize(steps);
+    out.close.resize(steps);
+    out.volume.resize(steps);
+    out.adjclose.clear();
+    out.dividends.clear();
+    out.splits.clear();
+    out.adjusted = {};
+
+    // Every step is written at slot k; k only advances for kept bars, so drops cost no branch
+    const bool  dropBars = model_.missingRate > 0.0;
+    std::size_t k        = 0;
+    double      prev     = close_;
+    for (std::size_t i = 0; i < steps; ++i) {
+        const double open  = prev;
+        const double close = open * growth[i];
+        prev               = close;
+
+        out.timestamps[k] = timestamp_ + static_cast<int64_t>(i) * model_.barSeconds;
+        out.open[k]       = open;
+        out.close[k]      = close;
+        out.high[k]       = std::max(open, close) * (1.0 + wickScale * highU[i]);
+        out.low[k]        = std::min(open, close) * (1.0 - wickScale * lowU[i]);
+        out.volume[k]     = static_cast<int64_t>(model_.averageVolume * std::exp(0.5 * volumeZ[i] - 0.125));
+        k += dropBars ? static_cast<std::size_t>(missingU[i] >= model_.missingRate) : 1;
+    }
+
+    close_ = prev;
+    timestamp_ += static_cast<int64_t>(steps) * model_.barSeconds;
+
+    out.timestamps.resize(k);
+    out.open.resize(k);
+    out.high.resize(k);
+    out.low.resize(k);
+    out.close.resize(k);
+    out.volume.resize(k);
+    out.regularMarketPrice = k > 0 ? out.close.back() : close_;
+    return k;
+}
+
+std::shared_ptr<StockInfo> generateStock(const std::string& ticker, std::size_t steps, const PriceModel& model,
+                                         uint64_t seed) {
+    auto           info = std::make_shared<StockInfo>();
+    PriceGenerator generator(ticker, model, seed);
+
+    if (steps <= kChunk) {
+        generator.next(*info, steps);
+        return info;
+    }
+
+    // Bounded scratch: stream chunks and append, instead of sizing the scratch to the whole path
+    StockInfo chunk;
+    info->timestamps.reserve(steps);
+    info->open.reserve(steps);
+    info->high.reserve(steps);
+    info->low.reserve(steps);
+    info->close.reserve(steps);
+    info->volume.reserve(steps);
+
+    for (std::size_t done = 0; done < steps; done += kChunk) {
+        generator.next(chunk, std::min(kChunk, steps - done));
+        info->timestamps.insert(info->timestamps.end(), chunk.timestamps.begin(), chunk.timestamps.end());
+        info->open.insert(info->open.end(), chunk.open.begin(), chunk.open.end());
+        info->high.insert(info->high.end(), chunk.high.begin(), chunk.high.end());
+        info->low.insert(info->low.end(), chunk.low.begin(), chunk.low.end());
+        info->close.insert(info->close.end(), chunk.close.begin(), chunk.close.end());
+        info->volume.insert(info->volume.end(), chunk.volume.begin(), chunk.volume.end());
+        if (done == 0) {
+            info->ticker             = chunk.ticker;
+            info->currency           = chunk.currency;
+            info->exchangeName       = chunk.exchangeName;
+            info->instrumentType     = chunk.instrumentType;
+            info->timezone           = chunk.timezone;
+            info->firstTradeDate     = chunk.firstTradeDate;
+            info->chartPreviousClose = chunk.chartPreviousClose;
+        }
+    }
+    info->regularMarketPrice = generator.lastClose();
+    return info;
+}
+
+std::vector<std::shared_ptr<StockInfo>> generateUniverse(std::size_t tickers, std::size_t steps,
+                                                         const PriceModel& model, uint64_t seed) {
+    std::vector<std::shared_ptr<StockInfo>> universe;
+    universe.reserve(tickers);
+
+    for (std::size_t i = 0; i < tickers; ++i) {
+        std::string ticker = std::to_string(i);
+        ticker.insert(0, ticker.size() < kTickerW ? kTickerW - ticker.size() : 0, '0');
+
+        uint64_t state = seed ^ (static_cast<uint64_t>(i) * kGolden);
+        universe.push_back(generateStock("SYN" + ticker, steps, model, splitmix64(state)));
+    }
+    return universe;
+}
+
+/* ---- Macro ---- */
+
+std::vector<MacroSeriesModel> MacroModel::defaultSeries() {
+    // id, growth, initial, expansion, recession, noise, reversion
+    return {
+        {"UNRATE", false, 4.5, 4.0, 8.0, 0.10, 0.15},
+        {"PAYEMS", true, 130000.0, 0.0015, -0.0030, 0.0010, 0.0},
+        {"INDPRO", true, 90.0, 0.0020, -0.0060, 0.0040, 0.0},
+        {"CPIAUCSL", true, 130.0, 0.0025, 0.0010, 0.0020, 0.0},
+        {"CPILFESL", true, 130.0, 0.0022, 0.0015, 0.0010, 0.0},
+        {"PCEPI", true, 60.0, 0.0020, 0.0010, 0.0015, 0.0},
+        {"M2REAL", true, 3000.0, 0.0030, 0.0050, 0.0030, 0.0},
+        {"WM2NS", true, 3000.0, 0.0050, 0.0080, 0.0030, 0.0},
+        {"FEDFUNDS", false, 5.0, 4.5, 1.5, 0.15, 0.10},
+        {"UMCSENT", false, 90.0, 92.0, 65.0, 3.0, 0.20},
+        {"T10Y2Y", false, 1.0, 1.2, 0.3, 0.15, 0.10},
+        {"BAMLH0A0HYM2", false, 4.0, 3.5, 8.0, 0.30, 0.20},
+    };
+}
+
+std::vector<MacroAssetModel> MacroModel::defaultAssets() {
+    // name, expansion mean, recession mean, volatility (monthly)
+    return {
+        {"stocks", 0.009, -0.015, 0.045},
+        {"gold", 0.004, 0.008, 0.045},
+        {"metals", 0.007, -0.020, 0.060},
+        {"bonds", 0.003, 0.006, 0.020},
+        {"cash", 0.003, 0.001, 0.001},
+    };
+}
+
+SyntheticMacro generateMacro(const MacroModel& model, uint64_t seed) {
+    const std::size_t months = model.months;
+    Rng               rng(seed);
+    SyntheticMacro    macro;
+
+    std::vector<double> u(months);
+    rng.fillUniform(u.data(), months);
+
+    macro.recession.resize(months);
+    bool inRecession = model.startInRecession;
+    for (std::size_t i = 0; i < months; ++i) {
+        if (i > 0) {
+            const double leave = inRecession ? model.leaveRecession : model.enterRecession;
+            inRecession        = (u[i] < leave) != inRecession;
+        }
+        macro.recession[i] = inRecession;
+    }
+
+    macro.dates.reserve(months);
+    for (std::size_t i = 0; i < months; ++i) {
+        const auto year  = model.startYear + static_cast<int64_t>(i / 12);
+        const auto month = static_cast<unsigned>(i % 12 + 1);
+        char       buf[10];
+        civil::formatDays(civil::daysFromCivil(year, month, 1), buf);
+        macro.dates.emplace_back(buf, sizeof(buf));
+    }
+
+    std::vector<double> z(months);
+    for (const auto& spec : model.series) {
+        rng.fillNormal(z.data(), months);
+
+        auto info      = std::make_shared<FredSeriesInfo>();
+        info->seriesId = spec.id;
+        info->dates    = macro.dates;
+        info->values.resize(months);
+
+        double x = spec.initial;
+        for (std::size_t i = 0; i < months; ++i) {
+            const double target = macro.recession[i] ? spec.recession : spec.expansion;
+            if (spec.growth) {
+                x *= 1.0 + target + spec.noise * z[i];
+            } else {
+                x += spec.reversion * (target - x) + spec.noise * z[i];
+            }
+            info->values[i] = x;
+        }
+        macro.series[spec.id] = std::move(info);
+    }
+
+    for (const auto& spec : model.assets) {
+        rng.fillNormal(z.data(), months);
+
+        auto& returns = macro.assetReturns[spec.name];
+        returns.resize(months);
+        for (std::size_t i = 0; i < months; ++i) {
+            const double mean = macro.recession[i] ? spec.recessionMean : spec.expansionMean;
+            returns[i]        = mean + spec.volatility * z[i];
+        }
+    }
+    return macro;
+}
+
+}  // namespace synthetic
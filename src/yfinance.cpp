@@ -1,9 +1,14 @@
-#include <ctime>
+#include <algorithm>
+#include <cstdio>
 #include <iostream>
+#include <limits>
+#include <type_traits>
 
 #include <curl/curl.h>
 #include <nlohmann/json.hpp>
 
+#include "arena.hpp"
+#include "civil_date.hpp"
 #include "yfinance.hpp"
 
 void yFinance::init() {
@@ -14,94 +19,149 @@ void yFinance::close() {
     curl_global_cleanup();
 }
 
-static time_t parseDateToTimestamp(const std::string& date) {
-    std::tm tm = {};
-    if (strptime(date.c_str(), "%Y-%m-%d", &tm) == nullptr) {
-        return 0;
+static std::string stringValue(const ArenaJson& object, const char* key) {
+    const auto it = object.find(key);
+    if (it == object.end() || !it->is_string()) {
+        return "";
     }
-    tm.tm_isdst = 0;
-    return timegm(&tm);
+    return toStdString(*it);
 }
 
-std::shared_ptr<StockInfo> yFinance::getStockInfo(const std::string& ticker, const std::string& interval,
-                                                  const std::string& range) {
-    const auto fetched = fetch(std::string(url_base_) + ticker + "?interval=" + interval + "&range=" + range);
-    if (fetched.empty()) {
-        return nullptr;
-    }
-
-    const auto data = std::make_shared<StockInfo>();
-    if (!data) {
-        return nullptr;
+static int64_t parseDateToTimestamp(const std::string& date) {
+    int64_t days = 0;
+    if (!civil::parseDate(date, days)) {
+        return -1;
     }
+    return civil::toTimestamp(days);
+}
 
-    try {
-        const auto parsed = nlohmann::json::parse(fetched);
-        if (!parsed.contains("chart") || !parsed["chart"].contains("result") || parsed["chart"]["result"].is_null()) {
-            return nullptr;
-        }
+/* Copy an arena JSON string into out, reusing its capacity */
+static void assignString(const ArenaJson& node, std::string& out) {
+    const auto& s = node.get_ref<const ArenaString&>();
+    out.assign(s.data(), s.size());
+}
 
-        const auto& result = parsed["chart"]["result"][0];
-        const auto& meta   = result["meta"];
+/* Overwrite out with a JSON number array, reusing its capacity. Yahoo sends null
+   for bars without trades (e.g., halts): NaN for prices, no volume (0) for volumes */
+template <typename T>
+static void assignArray(const ArenaJson& array, std::vector<T>& out) {
+    T missing{};
+    if constexpr (std::is_floating_point_v<T>) {
+        missing = std::numeric_limits<T>::quiet_NaN();
+    }
 
-        data->ticker = ticker;
+    out.clear();
+    out.reserve(array.size());
+    for (const auto& v : array) {
+        out.push_back(v.is_null() ? missing : v.template get<T>());
+    }
+}
 
-        if (meta.contains("currency")) {
-            data->currency = meta["currency"];
+/* Overwrite out with the bar timestamps. A bar without a time cannot be placed
+   (the time index must stay sorted), so a null one makes the payload malformed */
+static bool assignTimestamps(const ArenaJson& array, std::vector<int64_t>& out) {
+    out.clear();
+    out.reserve(array.size());
+    for (const auto& v : array) {
+        if (!v.is_number()) {
+            return false;
         }
+        out.push_back(v.get<int64_t>());
+    }
+    return true;
+}
 
-        if (meta.contains("exchangeName")) {
-            data->exchangeName = meta["exchangeName"];
+/* Ask Yahoo for corporate actions in the same chart request */
+static constexpr const char* kEvents = "&events=div,splits";
+
+/* Read the "events" object of a chart result into sorted dividend/split lists */
+static void assignEvents(const ArenaJson& events, StockInfo& out) {
+    if (events.contains("dividends")) {
+        for (const auto& [key, e] : events["dividends"].items()) {
+            Dividend d;
+            d.timestamp = e.value("date", int64_t{0});
+            d.amount    = e.value("amount", 0.0);
+            out.dividends.push_back(d);
         }
-
-        if (meta.contains("instrumentType")) {
-            data->instrumentType = meta["instrumentType"];
+    }
+    if (events.contains("splits")) {
+        for (const auto& [key, e] : events["splits"].items()) {
+            Split sp;
+            sp.timestamp   = e.value("date", int64_t{0});
+            sp.numerator   = e.value("numerator", 1.0);
+            sp.denominator = e.value("denominator", 1.0);
+            out.splits.push_back(sp);
         }
+    }
 
-        if (meta.contains("regularMarketPrice")) {
-            data->regularMarketPrice = meta["regularMarketPrice"];
-        }
+    // Object keys are timestamp strings, which do not sort numerically
+    auto byTime = [](const auto& a, const auto& b) {
+        return a.timestamp < b.timestamp;
+    };
+    std::sort(out.dividends.begin(), out.dividends.end(), byTime);
+    std::sort(out.splits.begin(), out.splits.end(), byTime);
+}
 
-        if (meta.contains("chartPreviousClose")) {
-            data->chartPreviousClose = meta["chartPreviousClose"];
-        }
+/* Response body buffer reused across fetches on the same thread */
+static std::string& threadBuffer() {
+    thread_local std::string buffer;
+    return buffer;
+}
 
-        if (meta.contains("firstTradeDate")) {
-            data->firstTradeDate = meta["firstTradeDate"];
-        }
+/* Request URL buffer reused across fetches on the same thread */
+static std::string& threadUrl() {
+    thread_local std::string url;
+    return url;
+}
 
-        if (meta.contains("gmtoffset")) {
-            data->gmtoffset = meta["gmtoffset"];
-        }
+/*
+ * Chart decode arena reused across fetches on the same thread (sized for a multi-year daily chart).
+ * It lives until the thread exits, so its upstream is fixed rather than whatever default resource
+ * happens to be installed at the first fetch.
+ */
+static ParseArena& threadArena() {
+    thread_local ParseArena arena(1024 * 1024, std::pmr::new_delete_resource());
+    return arena;
+}
 
-        if (meta.contains("timezone")) {
-            data->timezone = meta["timezone"];
-        }
+/* Reset every field parseStockInfo fills, keeping the column capacity */
+static void resetStockInfo(const std::string& ticker, StockInfo& out) {
+    out.touch();
+    out.ticker = ticker;
+    out.currency.clear();
+    out.exchangeName.clear();
+    out.instrumentType.clear();
+    out.timezone.clear();
+    out.regularMarketPrice = 0.0;
+    out.chartPreviousClose = 0.0;
+    out.firstTradeDate     = 0;
+    out.gmtoffset          = 0;
+    out.timestamps.clear();
+    out.open.clear();
+    out.high.clear();
+    out.low.clear();
+    out.close.clear();
+    out.volume.clear();
+    out.adjclose.clear();
+    out.dividends.clear();
+    out.splits.clear();
+    out.adjusted.factor.clear();
+    out.adjusted.open.clear();
+    out.adjusted.high.clear();
+    out.adjusted.low.clear();
+    out.adjusted.close.clear();
+}
 
-        if (result.contains("timestamp")) {
-            data->timestamps = result["timestamp"].get<std::vector<int64_t>>();
-        }
+std::shared_ptr<StockInfo> yFinance::getStockInfo(const std::string& ticker, const std::string& interval,
+                                                  const std::string& range) {
+    const auto data = std::make_shared<StockInfo>();
+    if (!data) {
+        return nullptr;
+    }
 
-        if (result.contains("indicators") && result["indicators"].contains("quote")) {
-            const auto& quote = result["indicators"]["quote"][0];
-            if (quote.contains("open")) {
-                data->open = quote["open"].get<std::vector<double>>();
-            }
-            if (quote.contains("high")) {
-                data->high = quote["high"].get<std::vector<double>>();
-            }
-            if (quote.contains("low")) {
-                data->low = quote["low"].get<std::vector<double>>();
-            }
-            if (quote.contains("close")) {
-                data->close = quote["close"].get<std::vector<double>>();
-            }
-            if (quote.contains("volume")) {
-                data->volume = quote["volume"].get<std::vector<int64_t>>();
-            }
-        }
-    } catch (const nlohmann::json::parse_error& e) {
-        std::cerr << "JSON parse error: " << e.what() << std::endl;
+    const auto status = getStockInfo(*data, ticker, interval, range);
+    if (status != FetchStatus::Ok) {
+        return nullptr;
     }
 
     return data;
@@ -109,146 +169,247 @@ std::shared_ptr<StockInfo> yFinance::getStockInfo(const std::string& ticker, con
 
 std::shared_ptr<StockInfo> yFinance::getStockInfo(const std::string& ticker, const std::string& startDate,
                                                   const std::string& endDate, const std::string& interval) {
+    const auto data = std::make_shared<StockInfo>();
+    if (!data) {
+        return nullptr;
+    }
+
+    const auto status = getStockInfo(*data, ticker, startDate, endDate, interval);
+    if (status != FetchStatus::Ok) {
+        return nullptr;
+    }
+
+    return data;
+}
+
+FetchStatus yFinance::getStockInfo(StockInfo& out, const std::string& ticker, const std::string& interval,
+                                   const std::string& range) {
+    auto& url = threadUrl();
+    url.assign(url_base_).append(ticker).append("?interval=").append(interval);
+    url.append("&range=").append(range).append(kEvents);
+
+    auto& body = threadBuffer();
+    if (!fetch(url, body)) {
+        return FetchStatus::NetworkError;
+    }
+
+    return parseStockInfo(body, ticker, out, threadArena());
+}
+
+FetchStatus yFinance::getStockInfo(StockInfo& out, const std::string& ticker, const std::string& startDate,
+                                   const std::string& endDate, const std::string& interval) {
     auto p1 = parseDateToTimestamp(startDate);
     auto p2 = parseDateToTimestamp(endDate);
 
     if (p1 == -1 || p2 == -1) {
-        return nullptr;
+        return FetchStatus::NoData;
     }
 
-    p2 += 86400;
+    p2 += civil::kSecondsPerDay;
 
-    const std::string url = std::string(url_base_) + ticker + "?period1=" + std::to_string(p1)
-                          + "&period2=" + std::to_string(p2) + "&interval=" + interval;
+    char period[24];
+    auto& url = threadUrl();
+    url.assign(url_base_).append(ticker);
+    url.append(period, std::snprintf(period, sizeof(period), "?period1=%lld", static_cast<long long>(p1)));
+    url.append(period, std::snprintf(period, sizeof(period), "&period2=%lld", static_cast<long long>(p2)));
+    url.append("&interval=").append(interval).append(kEvents);
 
-    const auto fetched = fetch(url);
-    if (fetched.empty()) {
-        return nullptr;
+    auto& body = threadBuffer();
+    if (!fetch(url, body)) {
+        return FetchStatus::NetworkError;
     }
 
-    const auto data = std::make_shared<StockInfo>();
-    if (!data) {
-        return nullptr;
-    }
+    return parseStockInfo(body, ticker, out, threadArena());
+}
 
+FetchStatus yFinance::parseStockInfo(std::string_view body, const std::string& ticker, StockInfo& out) {
+    ParseArena arena;
+    return parseStockInfo(body, ticker, out, arena);
+}
+
+FetchStatus yFinance::parseStockInfo(std::string_view body, const std::string& ticker, StockInfo& out,
+                                     ParseArena& arena) {
+    resetStockInfo(ticker, out);
+    arena.release();
     try {
-        const auto parsed = nlohmann::json::parse(fetched);
+        ArenaScope scope(arena);
+        const auto parsed = ArenaJson::parse(body.begin(), body.end());
         if (!parsed.contains("chart") || !parsed["chart"].contains("result") || parsed["chart"]["result"].is_null()) {
-            return nullptr;
+            return FetchStatus::NoData;
         }
 
         const auto& result = parsed["chart"]["result"][0];
         const auto& meta   = result["meta"];
 
-        data->ticker = ticker;
-
         if (meta.contains("currency")) {
-            data->currency = meta["currency"];
+            assignString(meta["currency"], out.currency);
         }
 
         if (meta.contains("exchangeName")) {
-            data->exchangeName = meta["exchangeName"];
+            assignString(meta["exchangeName"], out.exchangeName);
         }
 
         if (meta.contains("instrumentType")) {
-            data->instrumentType = meta["instrumentType"];
+            assignString(meta["instrumentType"], out.instrumentType);
         }
 
         if (meta.contains("regularMarketPrice")) {
-            data->regularMarketPrice = meta["regularMarketPrice"];
+            out.regularMarketPrice = meta["regularMarketPrice"];
         }
 
         if (meta.contains("chartPreviousClose")) {
-            data->chartPreviousClose = meta["chartPreviousClose"];
+            out.chartPreviousClose = meta["chartPreviousClose"];
         }
 
         if (meta.contains("firstTradeDate")) {
-            data->firstTradeDate = meta["firstTradeDate"];
+            out.firstTradeDate = meta["firstTradeDate"];
         }
 
         if (meta.contains("gmtoffset")) {
-            data->gmtoffset = meta["gmtoffset"];
+            out.gmtoffset = meta["gmtoffset"];
         }
 
         if (meta.contains("timezone")) {
-            data->timezone = meta["timezone"];
+            assignString(meta["timezone"], out.timezone);
         }
 
-        if (result.contains("timestamp")) {
-            data->timestamps = result["timestamp"].get<std::vector<int64_t>>();
+        if (result.contains("timestamp") && !assignTimestamps(result["timestamp"], out.timestamps)) {
+            std::cerr << "Malformed chart for " << ticker << ": bar without a timestamp" << std::endl;
+            resetStockInfo(ticker, out);
+            return FetchStatus::ParseError;
         }
 
         if (result.contains("indicators") && result["indicators"].contains("quote")) {
             const auto& quote = result["indicators"]["quote"][0];
             if (quote.contains("open")) {
-                data->open = quote["open"].get<std::vector<double>>();
+                assignArray(quote["open"], out.open);
             }
             if (quote.contains("high")) {
-                data->high = quote["high"].get<std::vector<double>>();
+                assignArray(quote["high"], out.high);
             }
             if (quote.contains("low")) {
-                data->low = quote["low"].get<std::vector<double>>();
+                assignArray(quote["low"], out.low);
             }
             if (quote.contains("close")) {
-                data->close = quote["close"].get<std::vector<double>>();
+                assignArray(quote["close"], out.close);
             }
             if (quote.contains("volume")) {
-                data->volume = quote["volume"].get<std::vector<int64_t>>();
+                assignArray(quote["volume"], out.volume);
             }
         }
-    } catch (const nlohmann::json::parse_error& e) {
+
+        if (result.contains("indicators") && result["indicators"].contains("adjclose")) {
+            const auto& adj = result["indicators"]["adjclose"][0];
+            if (adj.contains("adjclose")) {
+                assignArray(adj["adjclose"], out.adjclose);
+            }
+        }
+
+        if (result.contains("events")) {
+            assignEvents(result["events"], out);
+        }
+    } catch (const nlohmann::json::exception& e) {
+        // Malformed JSON, or a value of the wrong type part way through the columns
         std::cerr << "JSON parse error: " << e.what() << std::endl;
+        resetStockInfo(ticker, out);
+        return FetchStatus::ParseError;
     }
 
-    return data;
+    return FetchStatus::Ok;
 }
 
 std::shared_ptr<FearAndGreedInfo> yFinance::getFearAndGreedIndex() {
-    const auto fetched = fetch(std::string(cnn_url_base_), true);
-    if (fetched.empty()) {
+    const auto data = std::make_shared<FearAndGreedInfo>();
+    if (!data) {
         return nullptr;
     }
 
-    const auto data = std::make_shared<FearAndGreedInfo>();
-    if (!data) {
+    if (getFearAndGreedIndex(*data) != FetchStatus::Ok) {
         return nullptr;
     }
 
+    return data;
+}
+
+FetchStatus yFinance::getFearAndGreedIndex(FearAndGreedInfo& out) {
+    auto& body = threadBuffer();
+    if (!fetch(std::string(cnn_url_base_), body, true)) {
+        return FetchStatus::NetworkError;
+    }
+
+    return parseFearAndGreed(body, out);
+}
+
+FetchStatus yFinance::parseFearAndGreed(std::string_view body, FearAndGreedInfo& out) {
     try {
-        const auto parsed = nlohmann::json::parse(fetched);
+        ParseArena arena;
+        ArenaScope scope(arena);
+        const auto parsed = ArenaJson::parse(body.begin(), body.end());
         if (!parsed.contains("fear_and_greed")) {
-            return nullptr;
+            return FetchStatus::NoData;
         }
 
         const auto& fng = parsed["fear_and_greed"];
 
-        data->score         = fng.value("score", 0.0);
-        data->rating        = fng.value("rating", "");
-        data->timestamp     = fng.value("timestamp", "");
-        data->previousClose = fng.value("previous_close", 0.0);
-        data->previousWeek  = fng.value("previous_1_week", 0.0);
-        data->previousMonth = fng.value("previous_1_month", 0.0);
-        data->previousYear  = fng.value("previous_1_year", 0.0);
+        out.score         = fng.value("score", 0.0);
+        out.rating        = stringValue(fng, "rating");
+        out.timestamp     = stringValue(fng, "timestamp");
+        out.previousClose = fng.value("previous_close", 0.0);
+        out.previousWeek  = fng.value("previous_1_week", 0.0);
+        out.previousMonth = fng.value("previous_1_month", 0.0);
+        out.previousYear  = fng.value("previous_1_year", 0.0);
+
+        out.days.clear();
+        out.scores.clear();
+        out.ratings.clear();
 
         if (parsed.contains("fear_and_greed_historical") && parsed["fear_and_greed_historical"].contains("data")) {
-            for (const auto& item : parsed["fear_and_greed_historical"]["data"]) {
-                data->timestamps.push_back(static_cast<int64_t>(item.value("x", 0.0) / 1000.0));
-                data->scores.push_back(item.value("y", 0.0));
-                data->ratings.push_back(item.value("rating", ""));
+            const auto& history = parsed["fear_and_greed_historical"]["data"];
+            out.days.reserve(history.size());
+            out.scores.reserve(history.size());
+            out.ratings.reserve(history.size());
+
+            for (const auto& item : history) {
+                const auto seconds = static_cast<int64_t>(item.value("x", 0.0) / 1000.0);
+                out.days.push_back(static_cast<int32_t>(civil::toDays(seconds)));
+                out.scores.push_back(item.value("y", 0.0));
+
+                const auto rating = item.find("rating");
+                if (rating != item.end() && rating->is_string()) {
+                    const auto& label = rating->get_ref<const ArenaString&>();
+                    out.ratings.push_back(parseFngRating(std::string_view(label.data(), label.size())));
+                } else {
+                    out.ratings.push_back(FngRating::Unknown);
+                }
             }
         }
     } catch (const nlohmann::json::parse_error& e) {
         std::cerr << "JSON parse error: " << e.what() << std::endl;
-        return nullptr;
+        return FetchStatus::ParseError;
     }
 
-    return data;
+    return FetchStatus::Ok;
 }
 
 std::shared_ptr<FredSeriesInfo> yFinance::getFredSeries(const std::string& seriesId, const std::string& apiKey,
                                                         const std::string& observationStart,
                                                         const std::string& observationEnd,
                                                         const std::string& frequency) {
+    const auto data = std::make_shared<FredSeriesInfo>();
+    if (!data) {
+        return nullptr;
+    }
+
+    if (getFredSeries(*data, seriesId, apiKey, observationStart, observationEnd, frequency) != FetchStatus::Ok) {
+        return nullptr;
+    }
+
+    return data;
+}
+
+FetchStatus yFinance::getFredSeries(FredSeriesInfo& out, const std::string& seriesId, const std::string& apiKey,
+                                    const std::string& observationStart, const std::string& observationEnd,
+                                    const std::string& frequency) {
     std::string baseUrl =
         std::string(fred_url_base_) + "?series_id=" + seriesId + "&api_key=" + apiKey + "&file_type=json";
 
@@ -264,70 +425,94 @@ std::shared_ptr<FredSeriesInfo> yFinance::getFredSeries(const std::string& serie
         url += "&frequency=" + frequency;
     }
 
-    auto fetched = fetch(url);
-    if (fetched.empty()) {
-        return nullptr;
+    auto& body = threadBuffer();
+    if (!fetch(url, body)) {
+        return FetchStatus::NetworkError;
     }
 
-    const auto data = std::make_shared<FredSeriesInfo>();
-    if (!data) {
-        return nullptr;
+    /* Retry without frequency if the series doesn't support it */
+    if (!frequency.empty() && body.find("\"error_code\"") != std::string::npos) {
+        try {
+            ParseArena arena;
+            ArenaScope scope(arena);
+            const auto parsed = ArenaJson::parse(body);
+            const auto msg    = stringValue(parsed, "error_message");
+            if (msg.find("frequency") != std::string::npos && !fetch(baseUrl, body)) {
+                return FetchStatus::NetworkError;
+            }
+        } catch (const nlohmann::json::parse_error& e) {
+            std::cerr << "JSON parse error: " << e.what() << std::endl;
+            return FetchStatus::ParseError;
+        }
     }
 
+    return parseFredSeries(body, seriesId, out);
+}
+
+FetchStatus yFinance::parseFredSeries(std::string_view body, const std::string& seriesId, FredSeriesInfo& out) {
     try {
-        auto parsed = nlohmann::json::parse(fetched);
-
-        /* Retry without frequency if the series doesn't support it */
-        if (parsed.contains("error_code") && !frequency.empty()) {
-            const auto msg = parsed.value("error_message", "");
-            if (msg.find("frequency") != std::string::npos) {
-                fetched = fetch(baseUrl);
-                if (fetched.empty()) {
-                    return nullptr;
-                }
-                parsed = nlohmann::json::parse(fetched);
-            }
-        }
+        ParseArena arena;
+        ArenaScope scope(arena);
+        const auto parsed = ArenaJson::parse(body.begin(), body.end());
 
         if (parsed.contains("error_code")) {
             std::cerr << "FRED API error: " << parsed.value("error_message", "Unknown error") << std::endl;
-            return nullptr;
+            return FetchStatus::ApiError;
         }
 
         if (!parsed.contains("observations")) {
-            return nullptr;
+            return FetchStatus::NoData;
         }
 
-        data->seriesId = seriesId;
+        out.seriesId = seriesId;
+        out.dates.clear();
+        out.values.clear();
 
-        for (const auto& obs : parsed["observations"]) {
-            const auto dateStr  = obs.value("date", "");
-            const auto valueStr = obs.value("value", "");
+        const auto& observations = parsed["observations"];
+        out.dates.reserve(observations.size());
+        out.values.reserve(observations.size());
+
+        for (const auto& obs : observations) {
+            const auto dateIt  = obs.find("date");
+            const auto valueIt = obs.find("value");
+            if (valueIt == obs.end() || !valueIt->is_string()) {
+                continue;
+            }
 
             /* skip missing data marked as "." */
+            const auto& valueStr = valueIt->get_ref<const ArenaString&>();
             if (valueStr == "." || valueStr.empty()) {
                 continue;
             }
 
-            data->dates.push_back(dateStr);
-            data->values.push_back(std::stod(valueStr));
+            out.dates.emplace_back();
+            if (dateIt != obs.end() && dateIt->is_string()) {
+                assignString(*dateIt, out.dates.back());
+            }
+            out.values.push_back(std::stod(std::string(valueStr.data(), valueStr.size())));
         }
     } catch (const nlohmann::json::parse_error& e) {
         std::cerr << "JSON parse error: " << e.what() << std::endl;
-        return nullptr;
+        return FetchStatus::ParseError;
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
-        return nullptr;
+        return FetchStatus::ParseError;
     }
 
-    return data;
+    return FetchStatus::Ok;
 }
 
 std::string yFinance::fetch(const std::string& url, bool is_cnn) {
+    std::string buffer("");
+    fetch(url, buffer, is_cnn);
+    return buffer;
+}
+
+bool yFinance::fetch(const std::string& url, std::string& buffer, bool is_cnn) {
     CURL*    curl = nullptr;
     CURLcode res  = CURLE_OK;
 
-    std::string buffer("");
+    buffer.clear();
 
     curl = curl_easy_init();
     if (curl) {
@@ -355,7 +540,7 @@ std::string yFinance::fetch(const std::string& url, bool is_cnn) {
         }
         curl_easy_cleanup(curl);
     }
-    return buffer;
+    return res == CURLE_OK && !buffer.empty();
 }
 
 std::size_t yFinance::write(void* contents, std::size_t size, std::size_t nmemb, void* userp) {